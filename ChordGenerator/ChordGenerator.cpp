@@ -0,0 +1,133 @@
+/*
+  ChordGenerator.cpp - library to build chords and arpeggios over a scale
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "ChordGenerator.h"
+
+ChordGenerator::ChordGenerator(const int *offsets, int size, int root)
+{
+  setMode(offsets, size);
+  setRoot(root);
+
+  _arp_count = 0;
+  _arp_len = 0;
+  _arp_period = 0;
+  _arp_step = 0;
+  _arp_pattern = ARP_UP;
+}
+
+// turn mode intervals into cumulative offsets from root
+void ChordGenerator::setMode(const int *offsets, int size)
+{
+  _size = constrain(size, 1, CHORD_MAX_MODE_SIZE);
+
+  int cum = 0;
+  for (int i = 0; i < _size; i++)
+  {
+    _cum[i] = cum;
+    cum += offsets[i];
+  }
+  _span = cum;
+}
+
+void ChordGenerator::setRoot(int root)
+{
+  _root = constrain(root, 0, CHORD_CHROMATIC_SIZE - 1);
+}
+
+// move by mode span a note out of scale_chromatic[], so it stays on the mode
+int ChordGenerator::_fold(int idx)
+{
+  // degenerate mode (no span or wider than scale_chromatic[]): clamp
+  if ((_span == 0) || (_span >= CHORD_CHROMATIC_SIZE))
+    return constrain(idx, 0, CHORD_CHROMATIC_SIZE - 1);
+
+  while (idx >= CHORD_CHROMATIC_SIZE)
+    idx -= _span;
+  while (idx < 0)
+    idx += _span;
+  return idx;
+}
+
+int ChordGenerator::note(int degree)
+{
+  int octave = degree / _size;
+  int idx = degree % _size;
+  if (idx < 0)
+  {
+    idx += _size;
+    octave--;
+  }
+  return _fold(_root + octave * _span + _cum[idx]);
+}
+
+int ChordGenerator::chord(int degree, chord_type_t type, int *notes)
+{
+  // stack scale thirds: degree, degree+2, degree+4, ...
+  for (int i = 0; i < type; i++)
+  {
+    notes[i] = note(degree + 2 * i);
+  }
+  return type;
+}
+
+void ChordGenerator::setArpeggio(int degree, chord_type_t type, arp_pattern_t pattern, int octaves)
+{
+  octaves = constrain(octaves, 1, 4);
+
+  // chord notes are not folded here: octaves are added at each step
+  for (int i = 0; i < type; i++)
+  {
+    int d = degree + 2 * i;
+    int octave = d / _size;
+    int idx = d % _size;
+    if (idx < 0)
+    {
+      idx += _size;
+      octave--;
+    }
+    _arp_notes[i] = _root + octave * _span + _cum[idx];
+  }
+  _arp_count = type;
+  _arp_len = type * octaves;
+  _arp_pattern = pattern;
+
+  // up-down does not repeat top and bottom notes
+  if ((pattern == ARP_UP_DOWN) && (_arp_len > 1))
+    _arp_period = 2 * _arp_len - 2;
+  else
+    _arp_period = _arp_len;
+
+  _arp_step = 0;
+}
+
+void ChordGenerator::resetArpeggio()
+{
+  _arp_step = 0;
+}
+
+int ChordGenerator::nextArpeggio()
+{
+  if (_arp_len == 0)
+    return _root;
+
+  // position along the ascending sequence of chord notes
+  int pos = _arp_step;
+  if (_arp_pattern == ARP_DOWN)
+  {
+    pos = _arp_len - 1 - _arp_step;
+  }
+  else if ((_arp_pattern == ARP_UP_DOWN) && (_arp_step >= _arp_len))
+  {
+    pos = _arp_period - _arp_step;
+  }
+
+  if (++_arp_step >= _arp_period)
+    _arp_step = 0;
+
+  return _fold(_arp_notes[pos % _arp_count] + (pos / _arp_count) * _span);
+}
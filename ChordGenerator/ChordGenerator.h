@@ -0,0 +1,81 @@
+/*
+  ChordGenerator.h - library to build chords and arpeggios over a scale
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Given a root (index into scale_chromatic[] of scales.h) and a mode (one of the
+  scales.h offset tables, e.g. ionic_offset or blues_minor) build triads, sevenths
+  and arpeggio sequences. Mode intervals are turned into a cumulative table once,
+  so each note or arpeggio step is computed in constant time with no allocation:
+  it can be called inside a sequencer tick.
+*/
+
+#ifndef CHORDGENERATOR_H_INCLUDED
+#define CHORDGENERATOR_H_INCLUDED
+
+#include "Arduino.h"
+
+// same as FULL_CHROMATIC_SIZE of scales.h: generated notes are kept inside scale_chromatic[]
+#define CHORD_CHROMATIC_SIZE 89
+
+// max number of intervals in a mode (chromatic one)
+#define CHORD_MAX_MODE_SIZE 12
+
+// chord type: number of stacked scale thirds
+typedef enum
+{
+  CHORD_TRIAD   = 3,
+  CHORD_SEVENTH = 4,
+  CHORD_NINTH   = 5,
+} chord_type_t;
+
+#define CHORD_MAX_NOTES 5
+
+typedef enum
+{
+  ARP_UP,
+  ARP_DOWN,
+  ARP_UP_DOWN,
+} arp_pattern_t;
+
+class ChordGenerator
+{
+  public:
+    // root: index in scale_chromatic[]; offsets/size: mode as declared in scales.h
+    ChordGenerator(const int *offsets, int size, int root);
+
+    void setMode(const int *offsets, int size);
+    void setRoot(int root);
+
+    // index in scale_chromatic[] of a scale degree (0 is root, may be negative or above one octave)
+    int note(int degree);
+
+    // fill notes[] (at least 'type' items) with chord built on passed degree; return number of notes
+    int chord(int degree, chord_type_t type, int *notes);
+
+    // configure arpeggio on chord built on degree, spanning 'octaves' octaves
+    void setArpeggio(int degree, chord_type_t type, arp_pattern_t pattern, int octaves);
+    // next arpeggio note (index in scale_chromatic[]); sequence restarts when over
+    int nextArpeggio();
+    void resetArpeggio();
+
+  private:
+    // cumulative semitones from root for each mode degree, and full mode span (12 for scales.h modes)
+    uint8_t _cum[CHORD_MAX_MODE_SIZE];
+    uint8_t _size;
+    uint8_t _span;
+    int _root;
+
+    // arpeggio: chord notes computed once, steps walk them octave by octave
+    int _arp_notes[CHORD_MAX_NOTES];
+    uint8_t _arp_count;
+    uint8_t _arp_len;      // chord notes * octaves
+    uint8_t _arp_period;   // steps before sequence restart
+    uint8_t _arp_step;
+    arp_pattern_t _arp_pattern;
+
+    int _fold(int idx);
+};
+
+#endif // CHORDGENERATOR_H_INCLUDED
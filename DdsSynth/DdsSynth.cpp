@@ -0,0 +1,319 @@
+/*
+  DdsSynth.cpp - library to play polyphonic notes with a wavetable (DDS) synthesizer
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Each sample the mixer costs, per active voice, one 16-bit add, one PROGMEM read
+  and one 8x8 multiply; envelopes are stepped only every DDS_CONTROL_DIV samples.
+*/
+
+#include "DdsSynth.h"
+
+// shift applied to the sum of voices to keep mix in [-127:127]
+#if DDS_VOICES <= 2
+#define DDS_MIX_SHIFT 1
+#elif DDS_VOICES <= 4
+#define DDS_MIX_SHIFT 2
+#else
+#define DDS_MIX_SHIFT 3
+#endif
+
+#if DDS_VOICES > 8
+#error "DdsSynth: DDS_VOICES greater than 8 not supported"
+#endif
+
+// one sine period, signed 8 bit
+static const int8_t dds_sine[256] PROGMEM = {
+     0,    3,    6,    9,   12,   16,   19,   22,   25,   28,   31,   34,   37,   40,   43,   46,
+    49,   51,   54,   57,   60,   63,   65,   68,   71,   73,   76,   78,   81,   83,   85,   88,
+    90,   92,   94,   96,   98,  100,  102,  104,  106,  107,  109,  111,  112,  113,  115,  116,
+   117,  118,  120,  121,  122,  122,  123,  124,  125,  125,  126,  126,  126,  127,  127,  127,
+   127,  127,  127,  127,  126,  126,  126,  125,  125,  124,  123,  122,  122,  121,  120,  118,
+   117,  116,  115,  113,  112,  111,  109,  107,  106,  104,  102,  100,   98,   96,   94,   92,
+    90,   88,   85,   83,   81,   78,   76,   73,   71,   68,   65,   63,   60,   57,   54,   51,
+    49,   46,   43,   40,   37,   34,   31,   28,   25,   22,   19,   16,   12,    9,    6,    3,
+     0,   -3,   -6,   -9,  -12,  -16,  -19,  -22,  -25,  -28,  -31,  -34,  -37,  -40,  -43,  -46,
+   -49,  -51,  -54,  -57,  -60,  -63,  -65,  -68,  -71,  -73,  -76,  -78,  -81,  -83,  -85,  -88,
+   -90,  -92,  -94,  -96,  -98, -100, -102, -104, -106, -107, -109, -111, -112, -113, -115, -116,
+  -117, -118, -120, -121, -122, -122, -123, -124, -125, -125, -126, -126, -126, -127, -127, -127,
+  -127, -127, -127, -127, -126, -126, -126, -125, -125, -124, -123, -122, -122, -121, -120, -118,
+  -117, -116, -115, -113, -112, -111, -109, -107, -106, -104, -102, -100,  -98,  -96,  -94,  -92,
+   -90,  -88,  -85,  -83,  -81,  -78,  -76,  -73,  -71,  -68,  -65,  -63,  -60,  -57,  -54,  -51,
+   -49,  -46,  -43,  -40,  -37,  -34,  -31,  -28,  -25,  -22,  -19,  -16,  -12,   -9,   -6,   -3,
+};
+
+#if defined(ARDUINO) && defined(__AVR__)
+// instance played by the ISR (only one synth per board: it owns Timer1/Timer2)
+static DdsSynth *_dds_isr_synth = NULL;
+
+ISR(TIMER1_COMPA_vect)
+{
+  OCR2B = _dds_isr_synth->nextSample();
+}
+#endif // ARDUINO && __AVR__
+
+DdsSynth::DdsSynth()
+{
+  for (int i = 0; i < DDS_VOICES; i++)
+  {
+    _voice[i].phase = 0;
+    _voice[i].inc = 0;
+    _voice[i].level = 0;
+    _voice[i].stage = ENV_IDLE;
+    _voice[i].freq = 0;
+    _voice[i].stamp = 0;
+  }
+  _stamp = 0;
+  _control_cnt = 0;
+
+  // default envelope: quick attack, short decay to a mid sustain, medium release
+  setEnvelope(10, 100, 160, 300);
+}
+
+void DdsSynth::begin()
+{
+#if defined(ARDUINO) && defined(__AVR__)
+  _dds_isr_synth = this;
+
+  // Timer2: fast PWM, no prescaler, non-inverting output on OC2B
+#if defined(__AVR_ATmega2560__) || defined(__AVR_ATmega1280__)
+  pinMode(9, OUTPUT);
+#else
+  pinMode(3, OUTPUT);
+#endif
+  TCCR2A = _BV(COM2B1) | _BV(WGM21) | _BV(WGM20);
+  TCCR2B = _BV(CS20);
+  OCR2B = 128;
+
+  // Timer1: CTC mode, no prescaler, interrupt at DDS_SAMPLE_RATE
+  noInterrupts();
+  TCCR1A = 0;
+  TCCR1B = _BV(WGM12) | _BV(CS10);
+  OCR1A = (F_CPU / DDS_SAMPLE_RATE) - 1;
+  TIMSK1 |= _BV(OCIE1A);
+  interrupts();
+#endif // ARDUINO && __AVR__
+}
+
+void DdsSynth::end()
+{
+#if defined(ARDUINO) && defined(__AVR__)
+  TIMSK1 &= ~_BV(OCIE1A);
+  OCR2B = 128;
+#endif // ARDUINO && __AVR__
+}
+
+void DdsSynth::setEnvelope(int attack, int decay, int sustain, int release)
+{
+  // convert durations into number of control ticks (at least one)
+  long attack_ticks  = (long)attack  * DDS_CONTROL_RATE / 1000 + 1;
+  long decay_ticks   = (long)decay   * DDS_CONTROL_RATE / 1000 + 1;
+  long release_ticks = (long)release * DDS_CONTROL_RATE / 1000 + 1;
+
+  if (sustain < 0)
+    sustain = 0;
+  if (sustain > 255)
+    sustain = 255;
+
+  noInterrupts();
+  _sustain_level = (uint16_t)sustain << 8;
+  // steps never 0, otherwise a voice would stay in its stage forever
+  _attack_step  = DDS_ENV_MAX / attack_ticks + 1;
+  _decay_step   = (DDS_ENV_MAX - _sustain_level) / decay_ticks + 1;
+  _release_step = DDS_ENV_MAX / release_ticks + 1;
+  interrupts();
+}
+
+uint16_t DdsSynth::phaseIncrement(int freq)
+{
+  return (uint16_t)(((unsigned long)freq << 16) / DDS_SAMPLE_RATE);
+}
+
+int DdsSynth::noteOn(int freq)
+{
+  return noteOnInc(phaseIncrement(freq), freq);
+}
+
+int DdsSynth::noteOnInc(uint16_t inc, int freq)
+{
+  int v = -1;
+
+  // look for a free voice first
+  for (int i = 0; i < DDS_VOICES; i++)
+  {
+    if (_voice[i].stage == ENV_IDLE)
+    {
+      v = i;
+      break;
+    }
+  }
+  if (v < 0)
+  {
+    v = _stealVoice();
+  }
+
+  noInterrupts();
+  // keep phase of stolen voice to avoid a click; level restart from current one
+  _voice[v].inc = inc;
+  _voice[v].freq = freq;
+  _voice[v].stage = ENV_ATTACK;
+  _voice[v].stamp = ++_stamp;
+  interrupts();
+
+  return v;
+}
+
+// pick the voice to steal: quietest one in release stage, otherwise the oldest one
+int DdsSynth::_stealVoice()
+{
+  int v = -1;
+  uint16_t min_level = DDS_ENV_MAX;
+
+  for (int i = 0; i < DDS_VOICES; i++)
+  {
+    if ((_voice[i].stage == ENV_RELEASE) && (_voice[i].level <= min_level))
+    {
+      min_level = _voice[i].level;
+      v = i;
+    }
+  }
+  if (v >= 0)
+    return v;
+
+  // oldest: largest distance from current stamp (wrap safe)
+  uint16_t max_age = 0;
+  v = 0;
+  for (int i = 0; i < DDS_VOICES; i++)
+  {
+    uint16_t age = _stamp - _voice[i].stamp;
+    if (age >= max_age)
+    {
+      max_age = age;
+      v = i;
+    }
+  }
+  return v;
+}
+
+void DdsSynth::noteOff(int freq)
+{
+  noInterrupts();
+  for (int i = 0; i < DDS_VOICES; i++)
+  {
+    if ((_voice[i].freq == freq) && (_voice[i].stage != ENV_IDLE))
+    {
+      _voice[i].stage = ENV_RELEASE;
+    }
+  }
+  interrupts();
+}
+
+void DdsSynth::allOff()
+{
+  noInterrupts();
+  for (int i = 0; i < DDS_VOICES; i++)
+  {
+    if (_voice[i].stage != ENV_IDLE)
+    {
+      _voice[i].stage = ENV_RELEASE;
+    }
+  }
+  interrupts();
+}
+
+int DdsSynth::activeVoices()
+{
+  int cnt = 0;
+  for (int i = 0; i < DDS_VOICES; i++)
+  {
+    if (_voice[i].stage != ENV_IDLE)
+      cnt++;
+  }
+  return cnt;
+}
+
+// step envelope of each voice; called every DDS_CONTROL_DIV samples
+void DdsSynth::_updateEnvelopes()
+{
+  for (int i = 0; i < DDS_VOICES; i++)
+  {
+    dds_voice_t *v = &_voice[i];
+
+    switch (v->stage)
+    {
+    case ENV_ATTACK:
+      if (DDS_ENV_MAX - v->level <= _attack_step)
+      {
+        v->level = DDS_ENV_MAX;
+        v->stage = ENV_DECAY;
+      }
+      else
+      {
+        v->level += _attack_step;
+      }
+      break;
+
+    case ENV_DECAY:
+      if (v->level <= _sustain_level + _decay_step)
+      {
+        v->level = _sustain_level;
+        v->stage = ENV_SUSTAIN;
+      }
+      else
+      {
+        v->level -= _decay_step;
+      }
+      break;
+
+    case ENV_RELEASE:
+      if (v->level <= _release_step)
+      {
+        v->level = 0;
+        v->stage = ENV_IDLE;
+      }
+      else
+      {
+        v->level -= _release_step;
+      }
+      break;
+
+    default:
+      // ENV_IDLE and ENV_SUSTAIN: nothing to do
+      break;
+    }
+  }
+}
+
+uint8_t DdsSynth::nextSample()
+{
+  int mix = 0;
+
+  if (++_control_cnt == DDS_CONTROL_DIV)
+  {
+    _control_cnt = 0;
+    _updateEnvelopes();
+  }
+
+  for (int i = 0; i < DDS_VOICES; i++)
+  {
+    dds_voice_t *v = &_voice[i];
+
+    if (v->stage != ENV_IDLE)
+    {
+      v->phase += v->inc;
+      int8_t s = (int8_t)pgm_read_byte(&dds_sine[v->phase >> 8]);
+      mix += ((int)s * (uint8_t)(v->level >> 8)) >> 8;
+    }
+  }
+
+  return (uint8_t)(128 + (mix >> DDS_MIX_SHIFT));
+}
+
+void DdsSynth::render(uint8_t *buf, int len)
+{
+  for (int i = 0; i < len; i++)
+  {
+    buf[i] = nextSample();
+  }
+}
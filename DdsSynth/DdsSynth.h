@@ -0,0 +1,117 @@
+/*
+  DdsSynth.h - library to play polyphonic notes with a wavetable (DDS) synthesizer
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Replace Arduino tone() (monophonic, one timer per pin) with a small DDS engine:
+  a sine wavetable in PROGMEM is read by a 16-bit phase accumulator per voice,
+  up to 8 voices are mixed in a timer ISR and sent to a single PWM output.
+  Notes are passed as the NOTE_* frequency defined in pitches.h.
+*/
+
+#ifndef DDSSYNTH_H_INCLUDED
+#define DDSSYNTH_H_INCLUDED
+
+#ifdef ARDUINO
+#include "Arduino.h"
+#else
+// host build (no Arduino core): only the mixer and render() are available
+#include <stdint.h>
+#include <stddef.h>
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define noInterrupts()
+#define interrupts()
+#endif // ARDUINO
+
+/* Engine settings
+
+   sample rate: 16MHz / 1024, generated by Timer1 in CTC mode (Timer1 is no more
+   available for Servo or analogWrite() on pins 9/10).
+   output: Timer2 in fast PWM at 62.5KHz on OC2B (pin 3 on UNO, pin 9 on MEGA),
+   so tone() can not be used together with this library.
+   a RC low-pass filter (e.g. 1K + 100nF) on output pin is enough to drive an amplifier.
+*/
+#define DDS_SAMPLE_RATE  15625
+
+// number of voices mixed together (2..8): fixed here, as the library and sketches have to
+// agree on the size of DdsSynth (a define in a sketch does not reach DdsSynth.cpp)
+#define DDS_VOICES 4
+
+// envelope is updated once every DDS_CONTROL_DIV samples (~4ms)
+#define DDS_CONTROL_DIV  64
+#define DDS_CONTROL_RATE (DDS_SAMPLE_RATE / DDS_CONTROL_DIV)
+
+// envelope level is 8.8 fixed point; only the integer part is used in the mixer
+#define DDS_ENV_MAX 0xFF00
+
+// envelope stages of a single voice
+typedef enum
+{
+  ENV_IDLE,
+  ENV_ATTACK,
+  ENV_DECAY,
+  ENV_SUSTAIN,
+  ENV_RELEASE,
+} dds_env_stage_t;
+
+class DdsSynth
+{
+  public:
+    DdsSynth();
+
+    // start timers and PWM output (AVR only) - the instance is then played by the ISR
+    void begin();
+    void end();
+
+    // attack/decay/release duration in ms, sustain level in range [0:255]
+    void setEnvelope(int attack, int decay, int sustain, int release);
+
+    // start a note (NOTE_* frequency): return used voice index
+    // if no voice is free, the quietest released or the oldest one is stolen
+    int noteOn(int freq);
+    // start a note given its DDS phase increment (e.g. from a precomputed tuning table)
+    int noteOnInc(uint16_t inc, int freq);
+    // move to release stage all voices playing passed frequency
+    void noteOff(int freq);
+    void allOff();
+
+    // number of voices not in idle stage
+    int activeVoices();
+
+    // compute next mixed sample [0:255] centered on 128; called by ISR
+    uint8_t nextSample();
+    // render len samples into buf, used on host to generate WAV files and benchmark
+    void render(uint8_t *buf, int len);
+
+    // phase increment for a given frequency at DDS_SAMPLE_RATE
+    static uint16_t phaseIncrement(int freq);
+
+  private:
+    typedef struct
+    {
+      uint16_t phase;     // phase accumulator: 8 MSB index the wavetable
+      uint16_t inc;       // phase increment per sample
+      uint16_t level;     // envelope level (8.8)
+      uint8_t  stage;     // dds_env_stage_t
+      int      freq;      // note played, to match noteOff()
+      uint16_t stamp;     // noteOn() order, to steal oldest voice
+    } dds_voice_t;
+
+    dds_voice_t _voice[DDS_VOICES];
+
+    // envelope steps per control tick and sustain level (8.8)
+    uint16_t _attack_step;
+    uint16_t _decay_step;
+    uint16_t _release_step;
+    uint16_t _sustain_level;
+
+    uint16_t _stamp;
+    uint8_t  _control_cnt;
+
+    int  _stealVoice();
+    void _updateEnvelopes();
+};
+
+#endif // DDSSYNTH_H_INCLUDED
@@ -0,0 +1,115 @@
+/*
+  render_wav.cpp - host build of DdsSynth: render a melody to WAV and benchmark the mixer
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Build and run on PC (not part of the Arduino library):
+    g++ -O2 -I.. -I../../music render_wav.cpp ../DdsSynth.cpp -o render_wav
+    ./render_wav out.wav
+
+  The benchmark renders the same amount of samples with 1..DDS_VOICES active voices
+  and reports the cost per sample and per voice; on host it is only a relative figure,
+  to compare mixer changes with each other.
+*/
+
+#include <stdio.h>
+#include <chrono>
+
+#include "DdsSynth.h"
+#include "pitches.h"
+
+#define BENCH_SAMPLES (DDS_SAMPLE_RATE * 20)
+
+static void write_le(FILE *f, unsigned long val, int bytes)
+{
+  for (int i = 0; i < bytes; i++)
+  {
+    fputc((val >> (8 * i)) & 0xFF, f);
+  }
+}
+
+// 8-bit unsigned mono PCM, the same format sent to PWM
+static void write_wav(const char *name, const uint8_t *buf, long len)
+{
+  FILE *f = fopen(name, "wb");
+  if (f == NULL)
+  {
+    printf("can not open %s\n", name);
+    return;
+  }
+  fputs("RIFF", f);
+  write_le(f, 36 + len, 4);
+  fputs("WAVEfmt ", f);
+  write_le(f, 16, 4);
+  write_le(f, 1, 2);                  // PCM
+  write_le(f, 1, 2);                  // mono
+  write_le(f, DDS_SAMPLE_RATE, 4);
+  write_le(f, DDS_SAMPLE_RATE, 4);    // byte rate
+  write_le(f, 1, 2);                  // block align
+  write_le(f, 8, 2);                  // bits per sample
+  fputs("data", f);
+  write_le(f, len, 4);
+  fwrite(buf, 1, len, f);
+  fclose(f);
+}
+
+int main(int argc, char *argv[])
+{
+  const char *name = (argc > 1) ? argv[1] : "dds_synth.wav";
+
+  // C major arpeggio ending on a held chord: notes overlap to exercise voice stealing
+  int melody[] = { NOTE_C4, NOTE_E4, NOTE_G4, NOTE_C5, NOTE_E5, NOTE_G5, NOTE_C6 };
+  int melody_len = sizeof(melody) / sizeof(melody[0]);
+  long note_len = DDS_SAMPLE_RATE / 4;
+  long total = note_len * (melody_len + 8);
+
+  static uint8_t wav[DDS_SAMPLE_RATE * 4];
+  if (total > (long)sizeof(wav))
+    total = sizeof(wav);
+
+  DdsSynth synth;
+  synth.setEnvelope(5, 150, 140, 600);
+
+  long pos = 0;
+  for (int i = 0; i < melody_len; i++)
+  {
+    synth.noteOn(melody[i]);
+    synth.render(&wav[pos], note_len);
+    pos += note_len;
+  }
+  synth.render(&wav[pos], note_len * 4);
+  pos += note_len * 4;
+  synth.allOff();
+  synth.render(&wav[pos], total - pos);
+
+  write_wav(name, wav, total);
+  printf("written %s: %ld samples at %d Hz\n", name, total, DDS_SAMPLE_RATE);
+
+  // benchmark: cost per sample with n active voices (sustained, never released)
+  static uint8_t bench[1024];
+  double base_ns = 0;
+  printf("voices\tns/sample\tns/voice\n");
+  for (int n = 0; n <= DDS_VOICES; n++)
+  {
+    DdsSynth b;
+    b.setEnvelope(0, 0, 255, 0);
+    for (int v = 0; v < n; v++)
+    {
+      b.noteOn(NOTE_A3 + 50 * v);
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (long done = 0; done < BENCH_SAMPLES; done += sizeof(bench))
+    {
+      b.render(bench, sizeof(bench));
+    }
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+    double ns = std::chrono::duration<double, std::nano>(stop - start).count() / BENCH_SAMPLES;
+    if (n == 0)
+      base_ns = ns;
+    printf("%d\t%.2f\t\t%.2f\n", n, ns, (n > 0) ? (ns - base_ns) / n : 0.0);
+  }
+  return 0;
+}
@@ -12,6 +12,12 @@
 
 #include "Arduino.h"
 #include "FadingPatternLed.h"
+#include "TimeBase.h"
+#ifdef LATENCY_PROBES
+#include "LatencyProbe.h"
+#else
+#define LATENCY_PROBE(id)
+#endif // LATENCY_PROBES
 
 #define _DEBUG_FADING_PATTERN_LED
 
@@ -22,112 +28,188 @@
 #define LED_FADE_IN 2
 #define LED_FADE_OUT 3
 
-// Max "excited" state (fast) paramters: duration and brightness
-#define FADE_IN_FAST_TIME  100
-#define LED_ON_FAST_TIME   100
-#define FADE_OUT_FAST_TIME 100
-#define LED_OFF_FAST_TIME  200
-#define FAST_BRIGHT 0  // zero is full brightness
-
-// milli-seconds needed to ramp up/down
-// from idle state to excited/fast one and vice-versa
-#define UP_TIME 8000
-#define DOWN_TIME 15000
+// UpdateDisplay() period (ms) requested by nextDeadline() while dithering a fade
+#define DITHER_PERIOD 2
 
+// kept for sketches setting it globally: quick ramp for all leds, whatever their profile
 bool quickrampOption = false;
 
 // constructor - create LedFader
 FadingPatternLed::FadingPatternLed(int pin, long fadeIn, long on, long fadeOut, long off, int max_bright)
+{
+  _own_profile = new FadingPatternProfile(fadeIn, on, fadeOut, off, max_bright);
+  _profile = _own_profile;
+  _init(pin);
+}
+
+FadingPatternLed::FadingPatternLed(int pin, const FadingPatternProfile *profile)
+{
+  _own_profile = NULL;
+  _profile = profile;
+  _init(pin);
+}
+
+FadingPatternLed::~FadingPatternLed()
+{
+  delete _own_profile;
+}
+
+void FadingPatternLed::_init(int pin)
 {
   // configure pin
   _ledPin = pin;
   pinMode(_ledPin, OUTPUT);
 
-  // init current value for dynamically changed pattern parameters and keep track of idle ones
-  _OnTime = _led_on_time_idle = on;
-  _OffTime = _led_off_time_idle = off;
-  _fadeInTime = _fade_in_time_idle = fadeIn;
-  _fadeOutTime = _fade_out_time_idle = fadeOut;
-  _maxBright = _idle_bright = max_bright;
+  // init current value for dynamically changed pattern parameters to idle ones
+  _OnTime = _profile->onTime;
+  _OffTime = _profile->offTime;
+  _fadeInTime = _profile->fadeInTime;
+  _fadeOutTime = _profile->fadeOutTime;
+  _maxBright = _profile->bright;
+
+  _out = NULL;
+  _gamma = NULL;
+  _dither = false;
+  _dither_err = 0;
 
   _ledState = LED_OFF;
   // init randomly the curr off time
   //_prevTime = random((pin-RED_LED)*fadeInTime/3, (pin+1-RED_LED)*fadeInTime/3);
-  _prevTime = millis();
+  _prevTime = timeNow();
 
   exciting = false;
+}
 
-  // init step to update brightness and duration for exiciting and relaxig
-  _bright_up_step= ceil((_idle_bright - FAST_BRIGHT)*SAMPLING_TIME/UP_TIME);
-  _bright_dw_step= ceil((_idle_bright - FAST_BRIGHT)*SAMPLING_TIME/DOWN_TIME);
+void FadingPatternLed::setProfile(const FadingPatternProfile *profile)
+{
+  _profile = profile;
+}
 
-  _blink_up_on_step  = max(1,((long)(_led_on_time_idle  - LED_ON_FAST_TIME))*SAMPLING_TIME/UP_TIME);
-  _blink_up_off_step = max(1,((long)(_led_off_time_idle - LED_OFF_FAST_TIME))*SAMPLING_TIME/UP_TIME);
-  _blink_up_in_step  = max(1,((long)(_fade_in_time_idle - FADE_IN_FAST_TIME))*SAMPLING_TIME/UP_TIME);
-  _blink_up_out_step = max(1,((long)(_fade_out_time_idle- FADE_OUT_FAST_TIME))*SAMPLING_TIME/UP_TIME);
+const FadingPatternProfile *FadingPatternLed::getProfile()
+{
+  return _profile;
+}
 
-  _blink_dw_on_step  = max(1,((long)(_led_on_time_idle  - LED_ON_FAST_TIME))*SAMPLING_TIME/DOWN_TIME);
-  _blink_dw_off_step = max(1,((long)(_led_off_time_idle - LED_OFF_FAST_TIME))*SAMPLING_TIME/DOWN_TIME);
-  _blink_dw_in_step  = max(1,((long)(_fade_in_time_idle - FADE_IN_FAST_TIME))*SAMPLING_TIME/DOWN_TIME);
-  _blink_dw_out_step = max(1,((long)(_fade_out_time_idle- FADE_OUT_FAST_TIME))*SAMPLING_TIME/DOWN_TIME);
+// render into a compositor layer channel instead of writing the pin (NULL to write pin again)
+void FadingPatternLed::setOutput(uint8_t *target)
+{
+  _out = target;
+}
+
+// pattern values are PWM for a common anode led (255 is off): layers hold intensity (0 is off)
+void FadingPatternLed::_output(int value)
+{
+  _output16((unsigned int)value << 8);
+}
+
+// 8.8 fixed point PWM value: gamma interpolated between LUT entries, then
+// sigma-delta dithered to 8 bits (error carried to next call) or rounded
+void FadingPatternLed::_output16(unsigned int value16)
+{
+  unsigned int level = 0xFF00 - value16;
+
+  if ((_gamma != NULL) && (_out == NULL))
+  {
+    uint8_t i = level >> 8;
+    uint8_t frac = level & 0xFF;
+    uint8_t lo = pgm_read_byte(_gamma + i);
+    uint8_t hi = (i < 255) ? pgm_read_byte(_gamma + i + 1) : lo;
+    level = ((unsigned int)lo << 8) + (int)(hi - lo) * frac;
+  }
+
+  uint8_t intensity;
+  if (_dither)
+  {
+    level += _dither_err;
+    _dither_err = level & 0xFF;
+    intensity = level >> 8;
+  }
+  else
+  {
+    intensity = (level > 0xFF7F) ? 255 : (level + 0x80) >> 8;
+  }
+
+  if (_out != NULL)
+    *_out = intensity;
+  else
+    analogWrite(_ledPin, 255 - intensity);
+}
+
+void FadingPatternLed::setDither(bool enable)
+{
+  _dither = enable;
+  _dither_err = 0;
+}
+
+void FadingPatternLed::setGamma(const uint8_t *lut_P)
+{
+  _gamma = lut_P;
 }
 
 // update dynamically current pattern settings based on input "excited" or not
 void FadingPatternLed::updatePattern()
 {
+  LATENCY_PROBE(PROBE_LED_UPDATE_PATTERN);
+
+  const FadingPatternProfile *p = _profile;
+
   if (exciting)
   {
     //increment max bright to blink (with saturation)
-    _maxBright = (((signed long)_maxBright - _bright_up_step) < FAST_BRIGHT ? FAST_BRIGHT : _maxBright - _bright_up_step);
+    _maxBright = (((signed long)_maxBright - p->brightUpStep) < p->fastBright ? p->fastBright : _maxBright - p->brightUpStep);
 
     // decrease duration of each blinking state to speed up flashing;
-    _OnTime = _OnTime - _blink_up_on_step;
-    _OnTime = max(_OnTime, LED_ON_FAST_TIME);
-    _OffTime = _OffTime - _blink_up_off_step;
-    _OffTime = max(_OffTime, LED_OFF_FAST_TIME);
-    _fadeInTime = _fadeInTime - _blink_up_in_step;
-    _fadeInTime = max(_fadeInTime, FADE_IN_FAST_TIME);
-    _fadeOutTime = _fadeOutTime - _blink_up_out_step;
-    _fadeOutTime = max(_fadeOutTime, FADE_OUT_FAST_TIME);
+    _OnTime = _OnTime - p->blinkUpOnStep;
+    _OnTime = max(_OnTime, p->fastOnTime);
+    _OffTime = _OffTime - p->blinkUpOffStep;
+    _OffTime = max(_OffTime, p->fastOffTime);
+    _fadeInTime = _fadeInTime - p->blinkUpInStep;
+    _fadeInTime = max(_fadeInTime, p->fastFadeInTime);
+    _fadeOutTime = _fadeOutTime - p->blinkUpOutStep;
+    _fadeOutTime = max(_fadeOutTime, p->fastFadeOutTime);
   }
   else
   {
-    //decrement max bright, not less then IDLE_BRIGHT
-    _maxBright = (((long)_maxBright + _bright_dw_step) < _idle_bright ? _maxBright + _bright_dw_step : _idle_bright);
+    //decrement max bright, not less then idle bright
+    _maxBright = (((long)_maxBright + p->brightDwStep) < p->bright ? _maxBright + p->brightDwStep : p->bright);
 
     // increase duration of each blinking state to move back to idle flashing
-    _OnTime = _OnTime + _blink_dw_on_step;
-    _OnTime = min(_OnTime, _led_on_time_idle);
-    _OffTime = _OffTime + _blink_dw_off_step;
-    _OffTime = min(_OffTime, _led_off_time_idle);
-    _fadeInTime = _fadeInTime + _blink_dw_in_step;
-    _fadeInTime = min(_fadeInTime, _fade_in_time_idle);
-    _fadeOutTime = _fadeOutTime + _blink_dw_out_step;
-    _fadeOutTime = min(_fadeOutTime, _fade_out_time_idle);
+    _OnTime = _OnTime + p->blinkDwOnStep;
+    _OnTime = min(_OnTime, p->onTime);
+    _OffTime = _OffTime + p->blinkDwOffStep;
+    _OffTime = min(_OffTime, p->offTime);
+    _fadeInTime = _fadeInTime + p->blinkDwInStep;
+    _fadeInTime = min(_fadeInTime, p->fadeInTime);
+    _fadeOutTime = _fadeOutTime + p->blinkDwOutStep;
+    _fadeOutTime = min(_fadeOutTime, p->fadeOutTime);
   }
 }
 
 
 
 //  void UpdateDisplay()
-void FadingPatternLed::UpdateDisplay (unsigned long currTime)
+void FadingPatternLed::UpdateDisplay (tick_t currTime)
 {
-  if ((exciting)&&(quickrampOption))
+  LATENCY_PROBE(PROBE_LED_UPDATE_DISPLAY);
+
+  tick_t elapsed = timeElapsed(currTime, _prevTime);
+
+  if ((exciting)&&((quickrampOption)||(_profile->quickramp)))
   {// move to excited state immediately- till released
-    analogWrite(_ledPin,FAST_BRIGHT);
+    _output(_profile->fastBright);
     _ledState=LED_ON;
     _prevTime=currTime;
-    _OnTime = LED_ON_FAST_TIME;
-    _OffTime = LED_OFF_FAST_TIME;
-    _fadeInTime = FADE_IN_FAST_TIME;
-    _fadeOutTime = FADE_OUT_FAST_TIME;
+    _OnTime = _profile->fastOnTime;
+    _OffTime = _profile->fastOffTime;
+    _fadeInTime = _profile->fastFadeInTime;
+    _fadeOutTime = _profile->fastFadeOutTime;
   }
   else
   {
     // check state machine, update status and prevTime, compute fade value if needed and update pin
     if (_ledState==LED_OFF)
     {//OFF->FADE_IN
-      if((signed long) (currTime-_prevTime) >= _OffTime)
+      if (timeReached(currTime, _prevTime + TIME_MS(_OffTime)))
       {
         _ledState = LED_FADE_IN;
         _prevTime = currTime;
@@ -137,26 +219,34 @@ void FadingPatternLed::UpdateDisplay (unsigned long currTime)
       }
       else
       {
-        analogWrite(_ledPin,255);
+        _output(255);
       }
     }
     else if (_ledState==LED_FADE_IN)
     {
-      if (currTime-_prevTime >= _fadeInTime)
+      if (timeReached(currTime, _prevTime + TIME_MS(_fadeInTime)))
       {//FADE_IN->ON
         _ledState = LED_ON;
         _prevTime = currTime;
-        analogWrite(_ledPin,_maxBright);
+        _output(_maxBright);
 #ifdef _DEBUG_FADING_PATTERN_LED_
       Serial.println("FADE_IN -> ON");
 #endif // _DEBUG_FADING_PATTERN_LED
       }
       else
       {//just update fade value
-        signed int fadeValue = 255 -((255-_maxBright)*(currTime-_prevTime)/_fadeInTime);
+        long fadeValue16 = (255L << 8) - (long)timeScale16(255 - _maxBright, elapsed, TIME_MS(_fadeInTime));
+        signed int fadeValue = 255 - (((255L << 8) - fadeValue16) >> 8);
         // if fadeTime has changed we may have been gone above maxBright
         fadeValue = max(fadeValue, _maxBright);
-        analogWrite(_ledPin,fadeValue);
+        if (_dither)
+        {
+          _output16(max(fadeValue16, (long)_maxBright << 8));
+        }
+        else
+        {
+          _output(fadeValue);
+        }
 #ifdef _DEBUG_FADING_PATTERN_LED_
       {
         static int cnt = 0;
@@ -169,34 +259,126 @@ void FadingPatternLed::UpdateDisplay (unsigned long currTime)
 #endif // _DEBUG_FADING_PATTERN_LED
       }
     }
-    else if ((_ledState==LED_ON)&&(currTime-_prevTime >= _OnTime))
+    else if ((_ledState==LED_ON)&&(timeReached(currTime, _prevTime + TIME_MS(_OnTime))))
     {//ON->FADE_OUT
       _ledState=LED_FADE_OUT;
       _prevTime=currTime;
       int fadeValue = _maxBright;
-      analogWrite(_ledPin,fadeValue);
+      _output(fadeValue);
 #ifdef _DEBUG_FADING_PATTERN_LED_
       Serial.println("ON -> FADE_OUT");
 #endif // _DEBUG_FADING_PATTERN_LED
     }
     else if (_ledState==LED_FADE_OUT)
     {
-      if (currTime-_prevTime >= _fadeOutTime)
+      if (timeReached(currTime, _prevTime + TIME_MS(_fadeOutTime)))
       {//FADE_OUT->OFF
         _ledState=LED_OFF;
         _prevTime=currTime;
-        analogWrite(_ledPin,255);
+        _output(255);
 #ifdef _DEBUG_FADING_PATTERN_LED_
       Serial.println("FADE_OUT -> OFF");
 #endif // _DEBUG_FADING_PATTERN_LED
       }
       else
       {//just update fade value
-        int fadeValue = _maxBright + ((255-_maxBright)*(currTime-_prevTime)/_fadeOutTime);
+        long fadeValue16 = ((long)_maxBright << 8) + (long)timeScale16(255 - _maxBright, elapsed, TIME_MS(_fadeOutTime));
+        int fadeValue = fadeValue16 >> 8;
         // if fadeOutTime has changed we may have gone above maxBright in negative delta.
         fadeValue = min(fadeValue, 255);
-        analogWrite(_ledPin,fadeValue);
+        if (_dither)
+        {
+          _output16(min(fadeValue16, 255L << 8));
+        }
+        else
+        {
+          _output(fadeValue);
+        }
       }
     }
   }
 }
+
+void FadingPatternLed::saveState(fading_pattern_state_t *state, tick_t currTime)
+{
+  state->on_time = _OnTime;
+  state->off_time = _OffTime;
+  state->fade_in_time = _fadeInTime;
+  state->fade_out_time = _fadeOutTime;
+  state->max_bright = _maxBright;
+  state->led_state = _ledState;
+  state->exciting = exciting;
+  state->elapsed = timeElapsed(currTime, _prevTime);
+}
+
+void FadingPatternLed::restoreState(const fading_pattern_state_t *state, tick_t currTime)
+{
+  _OnTime = state->on_time;
+  _OffTime = state->off_time;
+  _fadeInTime = state->fade_in_time;
+  _fadeOutTime = state->fade_out_time;
+  _maxBright = state->max_bright;
+  _ledState = state->led_state;
+  exciting = state->exciting;
+  _prevTime = currTime - state->elapsed;
+  _dither_err = 0;
+}
+
+bool FadingPatternLed::isRamping()
+{
+  const FadingPatternProfile *p = _profile;
+
+  if (exciting)
+  {
+    return ((_maxBright != p->fastBright) || (_OnTime != p->fastOnTime) || (_OffTime != p->fastOffTime) ||
+            (_fadeInTime != p->fastFadeInTime) || (_fadeOutTime != p->fastFadeOutTime));
+  }
+  return ((_maxBright != p->bright) || (_OnTime != p->onTime) || (_OffTime != p->offTime) ||
+          (_fadeInTime != p->fadeInTime) || (_fadeOutTime != p->fadeOutTime));
+}
+
+tick_t FadingPatternLed::nextDeadline(tick_t currTime)
+{
+  tick_t deadline;
+
+  if ((exciting)&&((quickrampOption)||(_profile->quickramp)))
+  {// led kept on: nothing changes till input is released
+    deadline = currTime + TIME_MS(SAMPLING_TIME);
+  }
+  else if (_ledState==LED_OFF)
+  {
+    deadline = _prevTime + TIME_MS(_OffTime);
+  }
+  else if (_ledState==LED_ON)
+  {
+    deadline = _prevTime + TIME_MS(_OnTime);
+  }
+  else
+  {
+    // fading: next pwm step (255-_maxBright steps over fade time), or end of fade
+    tick_t fadeTime = TIME_MS((_ledState==LED_FADE_IN) ? _fadeInTime : _fadeOutTime);
+    int steps = 255 - _maxBright;
+    deadline = _prevTime + fadeTime;
+    if (steps > 0)
+    {
+      tick_t step = max(TIME_MS(1), fadeTime / steps);
+      // dithering needs a refresh every period to average sub-steps
+      if (_dither)
+        step = TIME_MS(DITHER_PERIOD);
+      deadline = timeEarliest(deadline, currTime + step);
+    }
+  }
+
+  // pattern ramp needs updatePattern() every SAMPLING_TIME
+  if (isRamping())
+  {
+    deadline = timeEarliest(deadline, currTime + TIME_MS(SAMPLING_TIME));
+  }
+
+  // already late: call as soon as possible
+  if (timeBefore(deadline, currTime))
+  {
+    deadline = currTime;
+  }
+  return deadline;
+}
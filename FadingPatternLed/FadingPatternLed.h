@@ -14,6 +14,7 @@
 #define FADINGPATTERNLED_H_INCLUDED
 
 #include "Arduino.h"
+#include "TimeBase.h"
 
 
 /*A pattern is defined by 4 states:
@@ -34,14 +35,104 @@
   - if button is pressed (or any desired input) increase max_brightness and reduce blinking interval (Exicted/fast state).
   - if not pressed move back to idle pattern
 
-  NOTE: the fast/exicited led pattern paramters are hard-coded into source code while idle/relaxed ones
-        are application specific and passed in the constructor
+  NOTE: idle/relaxed and fast/excited pattern parameters, ramp times and quick ramp option make a
+        FadingPatternProfile, shared by many leds and switched at runtime with setProfile();
+        constructor with idle settings builds a profile of its own with default fast ones (below)
 
 */
 
 // input sampling interval
 #define SAMPLING_TIME  100
 
+// default max "excited" state (fast) paramters: duration and brightness
+#define FADE_IN_FAST_TIME  100
+#define LED_ON_FAST_TIME   100
+#define FADE_OUT_FAST_TIME 100
+#define LED_OFF_FAST_TIME  200
+#define FAST_BRIGHT 0  // zero is full brightness
+
+// default milli-seconds needed to ramp up/down
+// from idle state to excited/fast one and vice-versa
+#define UP_TIME 8000
+#define DOWN_TIME 15000
+
+// duration change every SAMPLING_TIME to ramp over delta in passed time (at least 1ms)
+constexpr long fadingPatternStep(long delta, long time)
+{
+  return (delta * SAMPLING_TIME / time) > 1 ? (delta * SAMPLING_TIME / time) : 1;
+}
+
+// idle and excited pattern settings with ramp steps computed once (at compile time
+// when declared constexpr), e.g.
+//   constexpr FadingPatternProfile nervous(800, 300, 800, 1500, 200, 50, 50, 50, 100, 0, 2000, 4000);
+struct FadingPatternProfile
+{
+  // idle (relaxed) pattern
+  long fadeInTime;
+  long onTime;
+  long fadeOutTime;
+  long offTime;
+  int  bright;
+
+  // max excited (fast) pattern
+  long fastFadeInTime;
+  long fastOnTime;
+  long fastFadeOutTime;
+  long fastOffTime;
+  int  fastBright;
+
+  // move to excited state immediately when input is active (no ramp up)
+  bool quickramp;
+
+  // step to increase/decrease brightness every sampling interval
+  int brightUpStep;
+  int brightDwStep;
+  // step to increase/decrease duration in each led pattern state every sampling interval
+  long blinkUpOnStep;
+  long blinkUpOffStep;
+  long blinkUpInStep;
+  long blinkUpOutStep;
+  long blinkDwOnStep;
+  long blinkDwOffStep;
+  long blinkDwInStep;
+  long blinkDwOutStep;
+
+  constexpr FadingPatternProfile(long fadeIn, long on, long fadeOut, long off, int max_bright,
+                                 long fastFadeIn = FADE_IN_FAST_TIME, long fastOn = LED_ON_FAST_TIME,
+                                 long fastFadeOut = FADE_OUT_FAST_TIME, long fastOff = LED_OFF_FAST_TIME,
+                                 int fast_bright = FAST_BRIGHT, long upTime = UP_TIME, long downTime = DOWN_TIME,
+                                 bool quick = false)
+    : fadeInTime(fadeIn), onTime(on), fadeOutTime(fadeOut), offTime(off), bright(max_bright),
+      fastFadeInTime(fastFadeIn), fastOnTime(fastOn), fastFadeOutTime(fastFadeOut), fastOffTime(fastOff),
+      fastBright(fast_bright), quickramp(quick),
+      brightUpStep((max_bright - fast_bright) * (long)SAMPLING_TIME / upTime),
+      brightDwStep((max_bright - fast_bright) * (long)SAMPLING_TIME / downTime),
+      blinkUpOnStep(fadingPatternStep(on - fastOn, upTime)),
+      blinkUpOffStep(fadingPatternStep(off - fastOff, upTime)),
+      blinkUpInStep(fadingPatternStep(fadeIn - fastFadeIn, upTime)),
+      blinkUpOutStep(fadingPatternStep(fadeOut - fastFadeOut, upTime)),
+      blinkDwOnStep(fadingPatternStep(on - fastOn, downTime)),
+      blinkDwOffStep(fadingPatternStep(off - fastOff, downTime)),
+      blinkDwInStep(fadingPatternStep(fadeIn - fastFadeIn, downTime)),
+      blinkDwOutStep(fadingPatternStep(fadeOut - fastFadeOut, downTime))
+  {
+  }
+};
+
+// runtime state for warm restart (see WarmRestart): ramp position, pattern state and
+// time spent in it (absolute times do not survive a reset), input
+typedef struct
+{
+  long on_time;
+  long off_time;
+  long fade_in_time;
+  long fade_out_time;
+  int max_bright;
+  uint8_t led_state;
+  bool exciting;
+  tick_t elapsed;      // time base ticks (see TimeBase)
+} fading_pattern_state_t;
+
 class FadingPatternLed
 {
   public:
@@ -49,17 +140,54 @@ class FadingPatternLed
     bool exciting;
 
     // Constructor and API: pin and 'idle' (aka relaxed) led pattern settings
+    // (profile allocated for this led: leds with same settings had better share one)
     FadingPatternLed(int pin, long fadeIn, long on, long fadeOut, long off, int max_bright);
+    // pin and a profile (kept by reference: it has to outlive the led)
+    FadingPatternLed(int pin, const FadingPatternProfile *profile);
+    ~FadingPatternLed();
+
+    // switch profile at runtime: current pattern ramps toward new settings
+    void setProfile(const FadingPatternProfile *profile);
+    const FadingPatternProfile *getProfile();
 
     // called to update led pattern based on excited or not state
     void updatePattern();
 
-    // called to update the led based on current status and current timing
+    // called to update the led based on current status and current timing (timeNow())
     // routine handle also the led pattern state transition
-    void UpdateDisplay (unsigned long currTime);
+    void UpdateDisplay (tick_t currTime);
+
+    // low power support: time (ticks) when UpdateDisplay() has next to be called to change led
+    // (end of current state or next fade step); includes next updatePattern() if ramping
+    tick_t nextDeadline(tick_t currTime);
+    // true till pattern has not reached excited (or idle) settings
+    bool isRamping();
+
+    // render pattern into a byte (e.g. a FrameCompositor layer channel) instead of
+    // writing the pin: intensity is stored, 0 off and 255 full brightness
+    void setOutput(uint8_t *target);
+    // perceptual fades: 256 bytes PROGMEM intensity LUT applied to pin writes (NULL: none),
+    // e.g. led_gamma of LedCalibration/led_gamma.h; layers are not corrected
+    void setGamma(const uint8_t *lut_P);
+    // fades computed in 8.8 fixed point and sigma-delta dithered on the 8-bit PWM: smooth
+    // slow or dim fades as long as UpdateDisplay() is called about every PWM period (1-2ms)
+    void setDither(bool enable);
+
+    // warm restart: copy runtime state out, and back after a reset; pattern resumes at the
+    // same phase (profile, output and gamma settings are not part of it)
+    void saveState(fading_pattern_state_t *state, tick_t currTime);
+    void restoreState(const fading_pattern_state_t *state, tick_t currTime);
 
   private:
     int  _ledPin;  // GPIO to drive led
+    uint8_t *_out; // if set, layer channel where to render instead of _ledPin
+    const uint8_t *_gamma; // if set, PROGMEM gamma LUT
+
+    bool _dither;
+    uint8_t _dither_err; // sigma-delta error accumulator (1/256 of a step)
+
+    void _output(int value);
+    void _output16(unsigned int value16);
 
     // dynamically changed pattern parameters (led state timings and max brightness)
     // need to be public to be accessed by extern when printing value
@@ -73,27 +201,18 @@ class FadingPatternLed
     int _ledState;
 
     // keep track of timing to update led pattern state
-    signed long _prevTime;
-
-    long _led_on_time_idle;
-    long _led_off_time_idle;
-    long _fade_in_time_idle;
-    long _fade_out_time_idle;
-    int _idle_bright;
-
-    // step to increase/decrease brightness every sampling interval
-    int _bright_up_step;
-    int _bright_dw_step;
-    // step to increase/decrease duration in each led pattern state every sampling interval
-    unsigned long _blink_up_on_step;
-    unsigned long _blink_up_off_step;
-    unsigned long _blink_up_in_step;
-    unsigned long _blink_up_out_step;
-
-    unsigned long _blink_dw_on_step;
-    unsigned long _blink_dw_off_step;
-    unsigned long _blink_dw_in_step;
-    unsigned long _blink_dw_out_step;
+    tick_t _prevTime;
+
+    // idle/fast settings and ramp steps in use
+    const FadingPatternProfile *_profile;
+    // profile built from idle settings passed to constructor (NULL: none)
+    FadingPatternProfile *_own_profile;
+
+    void _init(int pin);
+
+    // not copyable: the own profile is freed by destructor
+    FadingPatternLed(const FadingPatternLed &);
+    FadingPatternLed &operator=(const FadingPatternLed &);
 };
 
 #endif // FADINGPATTERNLED_H_INCLUDED
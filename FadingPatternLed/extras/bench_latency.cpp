@@ -0,0 +1,239 @@
+/*
+  bench_latency.cpp - host benchmark of input-to-light latency
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Build and run on PC (not part of the Arduino library):
+    g++ -O2 -I../../extras/host -I.. -I../../TimeBase -I../../SoftPressSensor \
+        bench_latency.cpp ../FadingPatternLed.cpp ../../SoftPressSensor/SoftPressSensor.cpp \
+        ../../TimeBase/TimeBase.cpp ../../extras/host/Arduino.cpp -o bench_latency
+    ./bench_latency
+
+  Scripted press profiles go through the real SoftPressSensor and FadingPatternLed
+  code on the virtual clock: read() every sampling interval, exciting = isPressed(),
+  updatePattern() every SAMPLING_TIME, UpdateDisplay() every LOOP_MS. The PWM trace is
+  compared with the same run without the press, for presses at PHASES points of the
+  idle pattern (its phase changes latency). Reported in ms from press start:
+    - detect: first read() with isPressed()
+    - first change: first PWM value differing from the run without press
+    - full response: first time light reaches FULL_RESPONSE % of excited brightness
+      ("-" if not reached within press + 2s)
+  Sensor is calibrated by a first press at 1s; measured presses start from PRESS_AT_MS.
+  Tuning variants: default settings, adaptive sampling (nextSampleInterval()),
+  faster ramp up (1s) and quick ramp. With adaptive sampling a press is seen at the
+  next read(), up to IDLE_SAMPLING_TIME later (a shorter tap may be missed), then
+  followed in burst as with default settings.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "Arduino.h"
+#include "SoftPressSensor.h"
+#include "FadingPatternLed.h"
+
+#define SENSOR_PIN 0
+#define LED_PIN    9
+
+#define LOOP_MS        1
+#define PRESS_AT_MS    20000UL
+#define PHASES         8
+#define PHASE_STEP_MS  817      // about pattern period / PHASES, not aligned to sampling
+#define AFTER_PRESS_MS 2000UL
+#define FULL_RESPONSE  95       // % of excited brightness
+
+#define IDLE_VALUE 300
+
+// idle pattern of the led and excited brightness (as intensity)
+#define IDLE_FADE_IN  1500
+#define IDLE_ON       500
+#define IDLE_FADE_OUT 1500
+#define IDLE_OFF      3000
+#define IDLE_BRIGHT   200
+
+typedef struct
+{
+  const char *name;
+  int delta;              // raw value added to idle one at full press
+  unsigned long rise;     // ms to reach full press
+  unsigned long duration; // ms of press
+} press_profile_t;
+
+static const press_profile_t profiles[] = {
+  { "hard step",  150,   0, 10000 },
+  { "slow ramp",  150, 400, 10000 },
+  { "light",       45,   0, 10000 },
+  { "tap",        150,   0,  120 },
+};
+
+typedef struct
+{
+  const char *name;
+  bool adaptive;
+  const FadingPatternProfile *profile;
+} variant_t;
+
+constexpr FadingPatternProfile default_profile(IDLE_FADE_IN, IDLE_ON, IDLE_FADE_OUT, IDLE_OFF, IDLE_BRIGHT);
+constexpr FadingPatternProfile fast_profile(IDLE_FADE_IN, IDLE_ON, IDLE_FADE_OUT, IDLE_OFF, IDLE_BRIGHT,
+                                            FADE_IN_FAST_TIME, LED_ON_FAST_TIME, FADE_OUT_FAST_TIME,
+                                            LED_OFF_FAST_TIME, FAST_BRIGHT, 1000);
+constexpr FadingPatternProfile quick_profile(IDLE_FADE_IN, IDLE_ON, IDLE_FADE_OUT, IDLE_OFF, IDLE_BRIGHT,
+                                             FADE_IN_FAST_TIME, LED_ON_FAST_TIME, FADE_OUT_FAST_TIME,
+                                             LED_OFF_FAST_TIME, FAST_BRIGHT, UP_TIME, DOWN_TIME, true);
+
+static const variant_t variants[] = {
+  { "default",           false, &default_profile },
+  { "adaptive sampling", true,  &default_profile },
+  { "fast ramp",         false, &fast_profile },
+  { "quick ramp",        false, &quick_profile },
+};
+
+// current scripted press (NULL: none)
+static const press_profile_t *press;
+static unsigned long press_at;
+
+static int on_analog_read(uint8_t)
+{
+  int noise = (rand() % 3) - 1;
+  unsigned long t = millis();
+
+  // calibration press
+  if ((t >= 1000) && (t < 1500))
+    return IDLE_VALUE + 150 + noise;
+
+  if ((press != NULL) && (t >= press_at) && (t < press_at + press->duration))
+  {
+    unsigned long in = t - press_at;
+    int delta = ((press->rise == 0) || (in >= press->rise)) ? press->delta : press->delta * in / press->rise;
+    return IDLE_VALUE + delta + noise;
+  }
+  return IDLE_VALUE + noise;
+}
+
+static uint8_t led_pwm;
+static void on_analog_write(uint8_t, int value)
+{
+  led_pwm = value;
+}
+
+typedef struct
+{
+  long detect;
+  long first_change;
+  long full_response;
+} latency_t;
+
+// run the sketch till end; trace[] gets PWM of each loop from press_at (NULL: not recorded)
+static void run(const variant_t *variant, unsigned long end, uint8_t *trace, const uint8_t *ref, latency_t *lat)
+{
+  srand(1);
+  host_set_micros(0);
+
+  SoftPressSensor sensor(SENSOR_PIN);
+  FadingPatternLed led(LED_PIN, variant->profile);
+  unsigned long next_sample = 0;
+  unsigned long next_pattern = 0;
+  int full = (255 - variant->profile->fastBright) * FULL_RESPONSE / 100;
+
+  lat->detect = lat->first_change = lat->full_response = -1;
+
+  for (unsigned long now = 0; now < end; now += LOOP_MS)
+  {
+    host_set_micros((unsigned long long)now * 1000);
+
+    if ((signed long)(now - next_sample) >= 0)
+    {
+      sensor.read();
+      led.exciting = sensor.isPressed();
+      next_sample = now + (variant->adaptive ? sensor.nextSampleInterval() : BURST_SAMPLING_TIME);
+    }
+    if ((signed long)(now - next_pattern) >= 0)
+    {
+      led.updatePattern();
+      next_pattern = now + SAMPLING_TIME;
+    }
+    led.UpdateDisplay(now);
+
+    if (now < press_at)
+      continue;
+
+    long since = now - press_at;
+    if (trace != NULL)
+      trace[since / LOOP_MS] = led_pwm;
+    if (ref == NULL)
+      continue;
+
+    if ((lat->detect < 0) && (led.exciting))
+      lat->detect = since;
+    if ((lat->first_change < 0) && (led_pwm != ref[since / LOOP_MS]))
+      lat->first_change = since;
+    if ((lat->full_response < 0) && ((255 - led_pwm) >= full))
+      lat->full_response = since;
+  }
+}
+
+static void print_stat(const long *v, int n)
+{
+  long min = 0, max = 0, sum = 0;
+  int valid = 0;
+  for (int i = 0; i < n; i++)
+  {
+    if (v[i] < 0)
+      continue;
+    if ((valid == 0) || (v[i] < min))
+      min = v[i];
+    if ((valid == 0) || (v[i] > max))
+      max = v[i];
+    sum += v[i];
+    valid++;
+  }
+  if (valid == 0)
+    printf(" %16s", "-");
+  else if (valid < n)
+    printf(" %4ld/%4ld/%4ld%c", min, sum / valid, max, '*');
+  else
+    printf(" %4ld/%4ld/%4ld ", min, sum / valid, max);
+}
+
+int main()
+{
+  host_on_analog_read(on_analog_read);
+  host_on_analog_write(on_analog_write);
+
+  printf("latency from press start, ms min/avg/max over %d pattern phases (* some not reached)\n\n", PHASES);
+  printf("%-18s %-10s %16s %16s %16s\n", "variant", "press", "detect", "first change", "full response");
+
+  for (unsigned int v = 0; v < sizeof(variants) / sizeof(variants[0]); v++)
+  {
+    for (unsigned int p = 0; p < sizeof(profiles) / sizeof(profiles[0]); p++)
+    {
+      long detect[PHASES], first[PHASES], full[PHASES];
+      unsigned long window = profiles[p].duration + AFTER_PRESS_MS;
+      static uint8_t ref[(10000 + AFTER_PRESS_MS) / LOOP_MS];
+
+      for (int ph = 0; ph < PHASES; ph++)
+      {
+        latency_t lat;
+        press_at = PRESS_AT_MS + ph * PHASE_STEP_MS;
+
+        // same run with no press, then with it
+        press = NULL;
+        run(&variants[v], press_at + window, ref, NULL, &lat);
+        press = &profiles[p];
+        run(&variants[v], press_at + window, NULL, ref, &lat);
+
+        detect[ph] = lat.detect;
+        first[ph] = lat.first_change;
+        full[ph] = lat.full_response;
+      }
+
+      printf("%-18s %-10s", variants[v].name, profiles[p].name);
+      print_stat(detect, PHASES);
+      print_stat(first, PHASES);
+      print_stat(full, PHASES);
+      printf("\n");
+    }
+  }
+  return 0;
+}
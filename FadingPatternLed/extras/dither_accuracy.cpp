@@ -0,0 +1,124 @@
+/*
+  dither_accuracy.cpp - host check of average output accuracy of dithered fades
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Build and run on PC (not part of the Arduino library):
+    g++ -O2 -I../../extras/host -I.. -I../../TimeBase -I../../NewtonColorCirclePlay \
+        -I../../music dither_accuracy.cpp ../FadingPatternLed.cpp \
+        ../../NewtonColorCirclePlay/NewtonColorCirclePlay.cpp \
+        ../../TimeBase/TimeBase.cpp ../../extras/host/Arduino.cpp -o dither_accuracy
+    ./dither_accuracy
+
+  Slow and dim fades are refreshed every REFRESH_MS (about one PWM period) on the
+  virtual clock; the 8-bit output is averaged over WINDOW_MS (what the eye integrates)
+  and compared with the ideal continuous intensity, with and without dithering:
+    - FadingPatternLed: 20s fade-in to max_bright 250 (5 PWM levels)
+    - NewtonColorCirclePlay::Render(): 20s fade-in of VIOLET red channel (0x33)
+  Errors are in 8-bit PWM steps (LSB).
+*/
+
+#include <stdio.h>
+#include <math.h>
+
+#include "Arduino.h"
+#include "FadingPatternLed.h"
+#include "NewtonColorCirclePlay.h"
+#include "pitches.h"
+
+#define REFRESH_MS 2
+#define WINDOW_MS  20
+#define FADE_MS    20000L
+#define OFF_MS     1000L
+
+#define LED_PIN    9
+
+typedef struct
+{
+  double sum;
+  double max;
+  long windows;
+} accuracy_t;
+
+static void account(accuracy_t *acc, double out_sum, double ideal_sum, int samples)
+{
+  double err = fabs(out_sum - ideal_sum) / samples;
+  acc->sum += err;
+  if (err > acc->max)
+    acc->max = err;
+  acc->windows++;
+}
+
+static void report(const char *name, bool dither, const accuracy_t *acc)
+{
+  printf("%-22s dither %-3s mean error %.3f LSB, max error %.3f LSB (%ld windows of %dms)\n",
+         name, dither ? "on" : "off", acc->sum / acc->windows, acc->max, acc->windows, WINDOW_MS);
+}
+
+static void fading_pattern(bool dither)
+{
+  uint8_t intensity = 0;
+  accuracy_t acc = { 0, 0, 0 };
+  host_set_micros(0);
+
+  FadingPatternLed led(LED_PIN, FADE_MS, 1000, FADE_MS, OFF_MS, 250);
+  led.setOutput(&intensity);
+  led.setDither(dither);
+
+  // off till OFF_MS, then fade in to 255-250 = 5 levels
+  double out_sum = 0, ideal_sum = 0;
+  int samples = 0;
+  for (unsigned long t = 0; t < OFF_MS + FADE_MS; t += REFRESH_MS)
+  {
+    led.UpdateDisplay(t);
+    if (t < OFF_MS)
+      continue;
+    out_sum += intensity;
+    ideal_sum += 5.0 * (t - OFF_MS) / FADE_MS;
+    if (++samples == WINDOW_MS / REFRESH_MS)
+    {
+      account(&acc, out_sum, ideal_sum, samples);
+      out_sum = ideal_sum = 0;
+      samples = 0;
+    }
+  }
+  report("FadingPatternLed", dither, &acc);
+}
+
+static void color_render(bool dither)
+{
+  uint8_t rgb[3] = { 0, 0, 0 };
+  accuracy_t acc = { 0, 0, 0 };
+  host_set_micros(0);
+
+  NewtonColorCirclePlay color(9, 10, 11, 100, COMMON_ANODE);
+  color.setOutput(rgb);
+  color.setDither(dither);
+  color.Flash(NOTE_E4, FADE_MS, 0);
+
+  double out_sum = 0, ideal_sum = 0;
+  int samples = 0;
+  for (unsigned long t = 0; t < FADE_MS; t += REFRESH_MS)
+  {
+    color.Render(t);
+    out_sum += rgb[0];
+    ideal_sum += 51.0 * t / FADE_MS;
+    if (++samples == WINDOW_MS / REFRESH_MS)
+    {
+      account(&acc, out_sum, ideal_sum, samples);
+      out_sum = ideal_sum = 0;
+      samples = 0;
+    }
+  }
+  report("NewtonColorCirclePlay", dither, &acc);
+}
+
+int main()
+{
+  fading_pattern(false);
+  fading_pattern(true);
+  color_render(false);
+  color_render(true);
+  return 0;
+}
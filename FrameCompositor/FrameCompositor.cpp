@@ -0,0 +1,149 @@
+/*
+  FrameCompositor.cpp - library to combine several led sources on the same RGB led
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "FrameCompositor.h"
+#include "LedCalibration.h"
+
+// x*y/255 with 8-bit inputs, exact rounding without a division
+static inline uint8_t mul8(uint8_t x, uint8_t y)
+{
+  uint16_t t = (uint16_t)x * y + 128;
+  return (t + (t >> 8)) >> 8;
+}
+
+FrameCompositor::FrameCompositor(int red, int green, int blue, bool commonAnode)
+{
+  _pin[0] = red;
+  _pin[1] = green;
+  _pin[2] = blue;
+  _common_anode = commonAnode;
+  _layers = 0;
+  _calibration = NULL;
+
+  for (uint8_t c = 0; c < COMPOSITOR_CHANNELS; c++)
+  {
+    _frame[c] = 0;
+    _written[c] = -1;
+  }
+}
+
+int FrameCompositor::addLayer(blend_mode_t mode, uint8_t alpha)
+{
+  if (_layers >= COMPOSITOR_MAX_LAYERS)
+    return -1;
+
+  int idx = _layers++;
+  _mode[idx] = mode;
+  _alpha[idx] = alpha;
+  clear(idx);
+  return idx;
+}
+
+uint8_t *FrameCompositor::layer(int idx)
+{
+  if ((idx < 0) || (idx >= _layers))
+    return NULL;
+  return _layer[idx];
+}
+
+void FrameCompositor::setAlpha(int idx, uint8_t alpha)
+{
+  if ((idx >= 0) && (idx < _layers))
+    _alpha[idx] = alpha;
+}
+
+void FrameCompositor::setMode(int idx, blend_mode_t mode)
+{
+  if ((idx >= 0) && (idx < _layers))
+    _mode[idx] = mode;
+}
+
+void FrameCompositor::clear(int idx)
+{
+  if ((idx < 0) || (idx >= _layers))
+    return;
+  for (uint8_t c = 0; c < COMPOSITOR_CHANNELS; c++)
+    _layer[idx][c] = 0;
+}
+
+uint8_t FrameCompositor::_blend(uint8_t dst, uint8_t src, blend_mode_t mode, uint8_t alpha)
+{
+  uint8_t s = (alpha == 255) ? src : mul8(src, alpha);
+  uint16_t sum;
+
+  switch (mode)
+  {
+    case BLEND_ADD:
+      sum = (uint16_t)dst + s;
+      return (sum > 255) ? 255 : sum;
+    case BLEND_MAX:
+      return (s > dst) ? s : dst;
+    case BLEND_ALPHA:
+      // dst*(1-a) + src*a: never above 255
+      return mul8(dst, 255 - alpha) + s;
+    case BLEND_MULTIPLY:
+      // dst*(1-a) + dst*src*a: never above 255
+      return mul8(dst, 255 - alpha) + mul8(dst, s);
+  }
+  return dst;
+}
+
+void FrameCompositor::compose()
+{
+  // bottom layer over black
+  uint8_t f0 = 0, f1 = 0, f2 = 0;
+
+  for (uint8_t l = 0; l < _layers; l++)
+  {
+    blend_mode_t mode = _mode[l];
+    uint8_t alpha = _alpha[l];
+    // transparent layer: frame unchanged whatever the mode
+    if (alpha == 0)
+      continue;
+    f0 = _blend(f0, _layer[l][0], mode, alpha);
+    f1 = _blend(f1, _layer[l][1], mode, alpha);
+    f2 = _blend(f2, _layer[l][2], mode, alpha);
+  }
+
+  _frame[0] = f0;
+  _frame[1] = f1;
+  _frame[2] = f2;
+}
+
+void FrameCompositor::setCalibration(LedCalibration *cal)
+{
+  _calibration = cal;
+}
+
+void FrameCompositor::commit()
+{
+  uint8_t out[COMPOSITOR_CHANNELS] = { _frame[0], _frame[1], _frame[2] };
+  if (_calibration != NULL)
+    _calibration->apply(out);
+
+  for (uint8_t c = 0; c < COMPOSITOR_CHANNELS; c++)
+  {
+    int value = _common_anode ? (255 - out[c]) : out[c];
+    if (value != _written[c])
+    {
+      analogWrite(_pin[c], value);
+      _written[c] = value;
+    }
+  }
+}
+
+void FrameCompositor::update()
+{
+  compose();
+  commit();
+}
+
+const uint8_t *FrameCompositor::frame()
+{
+  return _frame;
+}
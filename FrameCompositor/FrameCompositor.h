@@ -0,0 +1,84 @@
+/*
+  FrameCompositor.h - library to combine several led sources on the same RGB led
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Sources do not write pins anymore: each one renders into its own 8-bit R-G-B
+  intensity layer (0 is off, 255 full on), e.g.
+    pattern.setOutput(comp.layer(base) + 1);   // FadingPatternLed on green channel
+    newton.setOutput(comp.layer(flash));       // NewtonColorCirclePlay note flash
+  then once per frame update() blends layers bottom to top and writes the pins,
+  only the changed ones, in a single commit.
+
+  Blend of layer L over frame F (saturating 8-bit integer math, per channel):
+    BLEND_ADD      : F + L*a
+    BLEND_MAX      : max(F, L*a)
+    BLEND_ALPHA    : F*(1-a) + L*a
+    BLEND_MULTIPLY : F*(1-a) + F*L*a
+  where a is the layer alpha (0..255 is 0..1).
+*/
+
+#ifndef FRAMECOMPOSITOR_H_INCLUDED
+#define FRAMECOMPOSITOR_H_INCLUDED
+
+#include "Arduino.h"
+
+class LedCalibration;
+
+#define COMPOSITOR_MAX_LAYERS 4
+#define COMPOSITOR_CHANNELS   3
+
+typedef enum
+{
+  BLEND_ADD,
+  BLEND_MAX,
+  BLEND_ALPHA,
+  BLEND_MULTIPLY,
+} blend_mode_t;
+
+class FrameCompositor
+{
+  public:
+    // RGB led pins; common anode leds are on when pin is low (PWM inverted at commit)
+    FrameCompositor(int red, int green, int blue, bool commonAnode);
+
+    // add a layer on top of previous ones: return its index (-1 if no room)
+    int addLayer(blend_mode_t mode, uint8_t alpha = 255);
+    // R-G-B intensity buffer of a layer, for sources to render into
+    uint8_t *layer(int idx);
+    void setAlpha(int idx, uint8_t alpha);
+    void setMode(int idx, blend_mode_t mode);
+    // clear a layer to off
+    void clear(int idx);
+
+    // blend layers into frame
+    void compose();
+    // color correction and gamma of the frame at commit (NULL: none)
+    void setCalibration(LedCalibration *cal);
+    // write frame to pins (changed channels only)
+    void commit();
+    // compose() and commit(): call once per frame after all sources rendered
+    void update();
+
+    // last composed R-G-B frame
+    const uint8_t *frame();
+
+  private:
+    static uint8_t _blend(uint8_t dst, uint8_t src, blend_mode_t mode, uint8_t alpha);
+
+    int _pin[COMPOSITOR_CHANNELS];
+    bool _common_anode;
+
+    uint8_t _layer[COMPOSITOR_MAX_LAYERS][COMPOSITOR_CHANNELS];
+    blend_mode_t _mode[COMPOSITOR_MAX_LAYERS];
+    uint8_t _alpha[COMPOSITOR_MAX_LAYERS];
+    uint8_t _layers;
+
+    uint8_t _frame[COMPOSITOR_CHANNELS];
+    LedCalibration *_calibration;
+    // last written pin values (-1 never written)
+    int _written[COMPOSITOR_CHANNELS];
+};
+
+#endif // FRAMECOMPOSITOR_H_INCLUDED
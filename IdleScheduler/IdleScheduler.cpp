@@ -0,0 +1,92 @@
+/*
+  IdleScheduler.cpp - library to sleep between deadlines of sensors and led patterns
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "IdleScheduler.h"
+#include "TimeBase.h"
+
+#if defined(ARDUINO) && defined(__AVR__)
+#include <avr/sleep.h>
+#endif // ARDUINO && __AVR__
+
+// max sleep when nobody requested a deadline (ms)
+#define MAX_SLEEP_TIME 1000
+
+IdleScheduler::IdleScheduler()
+{
+  _now = 0;
+  _deadline = 0;
+  _has_deadline = false;
+  resetStats();
+}
+
+void IdleScheduler::begin(tick_t currTime)
+{
+  _now = currTime;
+  _has_deadline = false;
+  _wakeups++;
+}
+
+void IdleScheduler::request(tick_t deadline)
+{
+  if ((!_has_deadline) || (timeBefore(deadline, _deadline)))
+  {
+    _deadline = deadline;
+    _has_deadline = true;
+  }
+}
+
+void IdleScheduler::requestIn(unsigned long interval)
+{
+  request(_now + TIME_MS(interval));
+}
+
+void IdleScheduler::sleep()
+{
+  if (!_has_deadline)
+  {
+    _deadline = _now + TIME_MS(MAX_SLEEP_TIME);
+  }
+
+  tick_t start = timeNow();
+  if (timeReached(start, _deadline))
+    return;
+
+#if defined(ARDUINO) && defined(__AVR__)
+  set_sleep_mode(SLEEP_MODE_IDLE);
+  while (!timeReached(timeNow(), _deadline))
+  {
+    // any interrupt (Timer0 tick included) wakes up the CPU
+    sleep_enable();
+    sleep_cpu();
+    sleep_disable();
+  }
+#else
+  timeSleepUntil(_deadline);
+#endif // ARDUINO && __AVR__
+
+  tick_t slept = _slept_rem + timeElapsed(timeNow(), start);
+  _slept += TIME_TO_MS(slept);
+  _slept_rem = slept % TIME_TICKS_PER_MS;
+}
+
+unsigned long IdleScheduler::wakeups()
+{
+  return _wakeups;
+}
+
+unsigned long IdleScheduler::sleptTime()
+{
+  return _slept;
+}
+
+void IdleScheduler::resetStats()
+{
+  _wakeups = 0;
+  _slept = 0;
+  _slept_rem = 0;
+}
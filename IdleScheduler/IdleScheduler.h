@@ -0,0 +1,57 @@
+/*
+  IdleScheduler.h - library to sleep between deadlines of sensors and led patterns
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Battery installations do not need to spin loop() when nothing changes: each
+  loop the sketch requests the next deadline of every object (e.g.
+  SoftPressSensor::nextSampleInterval(), FadingPatternLed::nextDeadline()) and the
+  MCU sleeps till the earliest one.
+
+  Times are TimeBase ticks (see TimeBase: timeNow()), intervals are ms.
+
+  On AVR the CPU goes in SLEEP_MODE_IDLE: timers and PWM keep running (so millis()
+  and analogWrite() work), the Timer0 tick wakes it every ms just to check the
+  deadline and go back to sleep. On other boards (and on PC simulation) it simply
+  waits with timeSleepUntil().
+*/
+
+#ifndef IDLESCHEDULER_H_INCLUDED
+#define IDLESCHEDULER_H_INCLUDED
+
+#include "Arduino.h"
+#include "TimeBase.h"
+
+class IdleScheduler
+{
+  public:
+    IdleScheduler();
+
+    // start a loop iteration: no deadline yet
+    void begin(tick_t currTime);
+    // request to be awake at passed time; earliest request wins
+    void request(tick_t deadline);
+    // request to be awake after passed interval (ms) from begin() time
+    void requestIn(unsigned long interval);
+    // sleep till earliest deadline requested since begin()
+    void sleep();
+
+    // statistics: loop iterations (wake-ups) and time spent sleeping (ms)
+    unsigned long wakeups();
+    unsigned long sleptTime();
+    void resetStats();
+
+  private:
+    tick_t _now;
+    tick_t _deadline;
+    bool _has_deadline;
+
+    unsigned long _wakeups;
+    // slept time in ms (ticks wrap after 71 minutes with TIMEBASE_MICROS), and the
+    // sub-ms ticks left over to add to next sleep
+    unsigned long _slept;
+    tick_t _slept_rem;
+};
+
+#endif // IDLESCHEDULER_H_INCLUDED
@@ -0,0 +1,127 @@
+/*
+  sim_idle.cpp - host simulation of wake-ups and active time with IdleScheduler
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Build and run on PC (not part of the Arduino library):
+    g++ -O2 -I../../extras/host -I.. -I../../TimeBase -I../../SoftPressSensor -I../../FadingPatternLed \
+        sim_idle.cpp ../IdleScheduler.cpp ../../SoftPressSensor/SoftPressSensor.cpp \
+        ../../FadingPatternLed/FadingPatternLed.cpp ../../TimeBase/TimeBase.cpp \
+        ../../extras/host/Arduino.cpp -o sim_idle
+    ./sim_idle
+
+  One hour of a sketch with one SoftPressSensor exciting one FadingPatternLed is run
+  on the virtual clock, for an idle scenario (nobody touches the pad) and an active one
+  (a 2s press every 10s), in two ways:
+    - polling: loop() spins, sensor read and led updated at each iteration
+    - adaptive: sensor sampled at nextSampleInterval(), MCU asleep till next deadline
+  Active time is the virtual time spent out of sleep (I/O has the cost of a 16MHz AVR,
+  plus LOOP_OVERHEAD_US of computation per iteration).
+*/
+
+#include <stdio.h>
+
+#include "Arduino.h"
+#include "SoftPressSensor.h"
+#include "FadingPatternLed.h"
+#include "IdleScheduler.h"
+
+#define SENSOR_PIN 0
+#define LED_PIN    9
+
+#define LOOP_OVERHEAD_US 30
+#define HOUR_MS 3600000UL
+
+#define IDLE_VALUE  300
+#define PRESS_VALUE 450
+
+static bool active_scenario;
+
+static int on_analog_read(uint8_t)
+{
+  int noise = (rand() % 3) - 1;
+  // active: pressed 2s every 10s
+  if ((active_scenario) && ((millis() % 10000) < 2000))
+    return PRESS_VALUE + noise;
+  return IDLE_VALUE + noise;
+}
+
+static void run(bool active, bool adaptive)
+{
+  active_scenario = active;
+  srand(1);
+  host_set_micros(0);
+
+  SoftPressSensor sensor(SENSOR_PIN);
+  FadingPatternLed led(LED_PIN, 1500, 500, 1500, 3000, 200);
+  IdleScheduler sched;
+
+  unsigned long next_sample = 0;
+  unsigned long next_pattern = 0;
+  unsigned long loops = 0;
+  unsigned long long active_us = 0;
+  unsigned long long elapsed_ms = 0;
+  unsigned long last = millis();
+
+  while (elapsed_ms < HOUR_MS)
+  {
+    unsigned long start_us = micros();
+    unsigned long now = millis();
+    loops++;
+
+    if (adaptive)
+    {
+      sched.begin(now);
+      if ((signed long)(now - next_sample) >= 0)
+      {
+        sensor.read();
+        led.exciting = sensor.isPressed();
+        next_sample = now + sensor.nextSampleInterval();
+      }
+      if ((signed long)(now - next_pattern) >= 0)
+      {
+        led.updatePattern();
+        next_pattern = now + SAMPLING_TIME;
+      }
+      led.UpdateDisplay(now);
+
+      sched.request(next_sample);
+      sched.request(led.nextDeadline(now));
+      host_advance_micros(LOOP_OVERHEAD_US);
+      active_us += micros() - start_us;
+      sched.sleep();
+    }
+    else
+    {
+      sensor.read();
+      led.exciting = sensor.isPressed();
+      if ((signed long)(now - next_pattern) >= 0)
+      {
+        led.updatePattern();
+        next_pattern = now + SAMPLING_TIME;
+      }
+      led.UpdateDisplay(now);
+      host_advance_micros(LOOP_OVERHEAD_US);
+      active_us += micros() - start_us;
+    }
+
+    elapsed_ms += millis() - last;
+    last = millis();
+  }
+
+  printf("%-7s %-9s %12lu wake-ups/h %10.1f s active/h (%5.1f%%)\n",
+         active ? "active" : "idle", adaptive ? "adaptive" : "polling", loops,
+         active_us / 1e6, 100.0 * active_us / (HOUR_MS * 1000.0));
+}
+
+int main()
+{
+  host_on_analog_read(on_analog_read);
+
+  run(false, false);
+  run(false, true);
+  run(true, false);
+  run(true, true);
+  return 0;
+}
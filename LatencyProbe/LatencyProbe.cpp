@@ -0,0 +1,75 @@
+/*
+  LatencyProbe.cpp - library to measure duration of library hot paths in the field
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "LatencyProbe.h"
+
+#ifdef LATENCY_PROBES
+
+static latency_histogram_t latency_hist[PROBE_COUNT];
+static unsigned long latency_last_loop;
+static bool latency_loop_started = false;
+
+LatencyProbe::~LatencyProbe()
+{
+  latencyRecord(_id, micros() - _start);
+}
+
+void latencyRecord(uint8_t id, unsigned long us)
+{
+  if (id >= PROBE_COUNT)
+    return;
+
+  // bucket: position of most significant bit
+  uint8_t b = 0;
+  unsigned long v = us >> 1;
+  while ((v != 0) && (b < LATENCY_BUCKETS - 1))
+  {
+    v >>= 1;
+    b++;
+  }
+
+  latency_histogram_t *h = &latency_hist[id];
+  if (h->bucket[b] != 0xFFFF)
+    h->bucket[b]++;
+  if ((h->count == 0) || (us < h->min))
+    h->min = us;
+  if (us > h->max)
+    h->max = us;
+  h->count++;
+}
+
+void latencyLoopTick()
+{
+  unsigned long now = micros();
+  if (latency_loop_started)
+  {
+    latencyRecord(PROBE_LOOP, now - latency_last_loop);
+  }
+  latency_last_loop = now;
+  latency_loop_started = true;
+}
+
+void latencySnapshot(uint8_t id, latency_histogram_t *snap)
+{
+  if (id >= PROBE_COUNT)
+    return;
+
+  noInterrupts();
+  *snap = latency_hist[id];
+  interrupts();
+}
+
+void latencyReset()
+{
+  noInterrupts();
+  memset(latency_hist, 0, sizeof(latency_hist));
+  latency_loop_started = false;
+  interrupts();
+}
+
+#endif // LATENCY_PROBES
@@ -0,0 +1,73 @@
+/*
+  LatencyProbe.h - library to measure duration of library hot paths in the field
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Each probe records call durations (us) into a fixed log2 histogram with
+  min/max/count: bucket 0 holds [0:2) us, bucket i holds [2^i : 2^(i+1)) us,
+  last one everything above. A snapshot can be fetched at any time.
+  Loop jitter is measured by calling latencyLoopTick() once per loop().
+
+  Instrumentation compiles out completely (no code, no RAM) unless LATENCY_PROBES
+  is defined in build flags (-DLATENCY_PROBES): instrumented libraries include this
+  header only then, and need no LatencyProbe library otherwise.
+*/
+
+#ifndef LATENCYPROBE_H_INCLUDED
+#define LATENCYPROBE_H_INCLUDED
+
+#include "Arduino.h"
+
+// instrumented functions
+typedef enum
+{
+  PROBE_SENSOR_READ,          // SoftPressSensor::read()
+  PROBE_LED_UPDATE_DISPLAY,   // FadingPatternLed::UpdateDisplay()
+  PROBE_LED_UPDATE_PATTERN,   // FadingPatternLed::updatePattern()
+  PROBE_COLOR_RENDER,         // NewtonColorCirclePlay::Render()
+  PROBE_LOOP,                 // loop() period, see latencyLoopTick()
+  PROBE_COUNT,
+} latency_probe_t;
+
+#define LATENCY_BUCKETS 16
+
+typedef struct
+{
+  uint16_t bucket[LATENCY_BUCKETS];   // saturated at 0xFFFF
+  unsigned long min;
+  unsigned long max;
+  unsigned long count;
+} latency_histogram_t;
+
+#ifdef LATENCY_PROBES
+
+// time the enclosing scope
+class LatencyProbe
+{
+  public:
+    LatencyProbe(uint8_t id) { _id = id; _start = micros(); }
+    ~LatencyProbe();
+
+  private:
+    uint8_t _id;
+    unsigned long _start;
+};
+
+#define LATENCY_PROBE(id) LatencyProbe _latency_probe(id)
+
+void latencyRecord(uint8_t id, unsigned long us);
+void latencyLoopTick();
+// copy histogram of a probe (safe while probes are running in interrupts)
+void latencySnapshot(uint8_t id, latency_histogram_t *snap);
+void latencyReset();
+
+#else
+
+#define LATENCY_PROBE(id)
+
+inline void latencyLoopTick() {}
+
+#endif // LATENCY_PROBES
+
+#endif // LATENCYPROBE_H_INCLUDED
@@ -0,0 +1,59 @@
+/*
+  LedCalibration.cpp - library to correct colors and gamma of an RGB led
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "LedCalibration.h"
+
+LedCalibration::LedCalibration()
+{
+  setMatrix(NULL);
+  setGamma(NULL);
+}
+
+void LedCalibration::setMatrix(const int16_t *matrix_P)
+{
+  _identity = true;
+  for (uint8_t i = 0; i < 9; i++)
+  {
+    int16_t ident = ((i % 4) == 0) ? CALIBRATION_ONE : 0;
+    _matrix[i] = (matrix_P != NULL) ? (int16_t)pgm_read_word(matrix_P + i) : ident;
+    if (_matrix[i] != ident)
+      _identity = false;
+  }
+}
+
+void LedCalibration::setGamma(const uint8_t *lut_P)
+{
+  setGamma(lut_P, lut_P, lut_P);
+}
+
+void LedCalibration::setGamma(const uint8_t *red_P, const uint8_t *green_P, const uint8_t *blue_P)
+{
+  _lut[0] = red_P;
+  _lut[1] = green_P;
+  _lut[2] = blue_P;
+}
+
+void LedCalibration::apply(uint8_t *rgb)
+{
+  if (!_identity)
+  {
+    uint8_t in[3] = { rgb[0], rgb[1], rgb[2] };
+    const int16_t *m = _matrix;
+    for (uint8_t c = 0; c < 3; c++, m += 3)
+    {
+      long v = ((long)m[0] * in[0] + (long)m[1] * in[1] + (long)m[2] * in[2] + CALIBRATION_ONE / 2) >> 8;
+      rgb[c] = (v < 0) ? 0 : ((v > 255) ? 255 : v);
+    }
+  }
+
+  for (uint8_t c = 0; c < 3; c++)
+  {
+    if (_lut[c] != NULL)
+      rgb[c] = pgm_read_byte(_lut[c] + rgb[c]);
+  }
+}
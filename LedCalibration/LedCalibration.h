@@ -0,0 +1,49 @@
+/*
+  LedCalibration.h - library to correct colors and gamma of an RGB led
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Intensities (0 off, 255 full on) go through:
+    - a 3x3 color correction matrix, Q8 fixed point (256 is 1.0), rows are output
+      R, G, B: it compensates cross-talk between channels of a led batch
+    - a gamma LUT per channel in PROGMEM: perceptually linear fades and white
+      balance (max output per channel) of the led
+  Tables are baked at build time by extras/gen_calibration.cpp, from values measured
+  on the device; led_gamma.h has a plain gamma 2.2 table.
+  When only white balance is needed the gains are folded into the LUTs and the
+  matrix left to identity: runtime cost is then one table lookup per channel.
+
+  Calibration is applied to what goes to pins: when sources render into
+  FrameCompositor layers, calibrate the compositor, not the sources.
+*/
+
+#ifndef LEDCALIBRATION_H_INCLUDED
+#define LEDCALIBRATION_H_INCLUDED
+
+#include "Arduino.h"
+
+#define CALIBRATION_ONE 256
+
+class LedCalibration
+{
+  public:
+    // identity matrix, linear channels
+    LedCalibration();
+
+    // 9 Q8 values in PROGMEM, row major (NULL for identity)
+    void setMatrix(const int16_t *matrix_P);
+    // PROGMEM 256 bytes LUTs (NULL for linear): same one for all channels or one each
+    void setGamma(const uint8_t *lut_P);
+    void setGamma(const uint8_t *red_P, const uint8_t *green_P, const uint8_t *blue_P);
+
+    // correct R-G-B intensities in place
+    void apply(uint8_t *rgb);
+
+  private:
+    int16_t _matrix[9];
+    bool _identity;
+    const uint8_t *_lut[3];
+};
+
+#endif // LEDCALIBRATION_H_INCLUDED
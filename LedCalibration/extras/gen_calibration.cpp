@@ -0,0 +1,145 @@
+/*
+  gen_calibration.cpp - host generator of led gamma LUTs and color correction matrix
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Measure the led batch once (e.g. with a light meter or a camera), then bake the
+  correction in PROGMEM tables for LedCalibration, so no math is needed on device.
+
+  Build and run on PC (not part of the Arduino library):
+    g++ -O2 gen_calibration.cpp -o gen_calibration
+    ./gen_calibration > ../led_gamma.h                         (plain gamma 2.2)
+    ./gen_calibration -g 2.5 -w 1,0.82,0.9 -p batch_a > batch_a.h
+    ./gen_calibration -m 1,-0.05,0,0,1,-0.1,0,0,1 -p batch_b > batch_b.h
+
+  options:
+    -g <gamma>     gamma exponent of LUTs (default 2.2)
+    -w <r,g,b>     white balance: max output of each channel, 0..1 (default 1,1,1),
+                   folded into per channel LUTs <prefix>_red/_green/_blue
+    -m <9 values>  color correction matrix row major, output R,G,B rows (default
+                   identity), generated as <prefix>_matrix in Q8
+    -p <name>      prefix of generated tables (default led_gamma)
+
+  Without -w a single table named <prefix> is shared by all channels.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <string>
+
+static void usage(const char *name)
+{
+  fprintf(stderr, "usage: %s [-g gamma] [-w r,g,b] [-m m00,..,m22] [-p prefix]\n", name);
+  exit(1);
+}
+
+// parse n comma separated values
+static void parse_list(const char *val, double *out, int n, const char *name)
+{
+  char *end;
+  for (int i = 0; i < n; i++)
+  {
+    out[i] = strtod(val, &end);
+    if ((end == val) || ((i < n - 1) && (*end != ',')) || ((i == n - 1) && (*end != '\0')))
+      usage(name);
+    val = end + 1;
+  }
+}
+
+static void print_lut(const std::string &name, double gamma, double gain)
+{
+  printf("const uint8_t %s[256] PROGMEM = {", name.c_str());
+  for (int i = 0; i < 256; i++)
+  {
+    if ((i % 16) == 0)
+      printf("\n ");
+    long v = lround(255.0 * gain * pow(i / 255.0, gamma));
+    printf(" %3ld,", (v > 255) ? 255L : v);
+  }
+  printf("\n};\n\n");
+}
+
+int main(int argc, char *argv[])
+{
+  double gamma = 2.2;
+  double gain[3] = { 1.0, 1.0, 1.0 };
+  double matrix[9] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+  bool balance = false;
+  bool correct = false;
+  std::string prefix = "led_gamma";
+
+  for (int i = 1; i < argc; i++)
+  {
+    if ((argv[i][0] != '-') || (i + 1 >= argc))
+      usage(argv[0]);
+    char opt = argv[i][1];
+    const char *val = argv[++i];
+    switch (opt)
+    {
+    case 'g': gamma = atof(val); break;
+    case 'w': parse_list(val, gain, 3, argv[0]); balance = true; break;
+    case 'm': parse_list(val, matrix, 9, argv[0]); correct = true; break;
+    case 'p': prefix = val; break;
+    default: usage(argv[0]);
+    }
+  }
+  if ((gamma <= 0) || (gamma > 5))
+    usage(argv[0]);
+  for (int c = 0; c < 3; c++)
+  {
+    if ((gain[c] < 0) || (gain[c] > 1))
+      usage(argv[0]);
+  }
+  for (int i = 0; i < 9; i++)
+  {
+    // Q8 must fit int16_t and keep products in range
+    if (fabs(matrix[i]) >= 8.0)
+      usage(argv[0]);
+  }
+
+  std::string up = prefix;
+  for (size_t i = 0; i < up.size(); i++)
+    up[i] = toupper(up[i]);
+
+  printf("/*\n  generated by gen_calibration: do not edit\n");
+  printf("  gamma %.2f", gamma);
+  if (balance)
+    printf(", white balance %.3f %.3f %.3f", gain[0], gain[1], gain[2]);
+  if (correct)
+    printf(", color correction matrix");
+  printf("\n*/\n\n");
+
+  printf("#ifndef %s_H_INCLUDED\n#define %s_H_INCLUDED\n\n", up.c_str(), up.c_str());
+  printf("#include \"Arduino.h\"\n\n");
+
+  if (balance)
+  {
+    static const char *channel[3] = { "red", "green", "blue" };
+    for (int c = 0; c < 3; c++)
+      print_lut(prefix + "_" + channel[c], gamma, gain[c]);
+  }
+  else
+  {
+    print_lut(prefix, gamma, 1.0);
+  }
+
+  if (correct)
+  {
+    printf("const int16_t %s_matrix[9] PROGMEM = {\n", prefix.c_str());
+    for (int r = 0; r < 3; r++)
+    {
+      printf(" ");
+      for (int c = 0; c < 3; c++)
+        printf(" %5ld,", lround(matrix[r * 3 + c] * 256.0));
+      printf("\n");
+    }
+    printf("};\n\n");
+  }
+
+  printf("#endif // %s_H_INCLUDED\n", up.c_str());
+  return 0;
+}
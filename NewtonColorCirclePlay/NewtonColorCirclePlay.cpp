@@ -11,6 +11,15 @@
 #include "Arduino.h"
 #include "NewtonColorCirclePlay.h"
 #include "pitches.h"
+#include "TimeBase.h"
+#ifdef LED_CALIBRATION
+#include "LedCalibration.h"
+#endif // LED_CALIBRATION
+#ifdef LATENCY_PROBES
+#include "LatencyProbe.h"
+#else
+#define LATENCY_PROBE(id)
+#endif // LATENCY_PROBES
 
 #define DEBUG_SERIAL  1
 
@@ -61,22 +70,22 @@ NewtonColorCirclePlay::NewtonColorCirclePlay(int red, int green, int blue, int f
   _greenValue = TURNED_ON;
   _blueValue = TURNED_ON;
 
-  analogWrite(_redPin,_redValue);
-  analogWrite(_greenPin,_greenValue);
-  analogWrite(_bluePin,_blueValue);
+  _out = NULL;
+  _calibration = NULL;
+  _dither = false;
+  _dither_err[0] = _dither_err[1] = _dither_err[2] = 0;
+  _flash_rgb = 0;
+  _flash_start = 0;
+  _flash_duration = 0;
+
+  _writePins(_redValue, _greenValue, _blueValue);
 }
 
-void NewtonColorCirclePlay::Display(int tone, int duration)
+// map sound into hex value (0xRRGGBB) for RGB led; 0 if pitch is not recognized
+unsigned long NewtonColorCirclePlay::_toneToHex(int tone)
 {
   unsigned long hex_rgb = 0;
-  signed int r_old = (signed int) _redValue;
-  signed int g_old = (signed int) _greenValue;
-  signed int b_old = (signed int) _blueValue;
 
-//  Serial.print("NewtonColorCirclePlay::Display : ");
-//  Serial.print(tone);
-
-  // map sound into hex value for RGB led
   switch (tone) {
   case NOTE_B0:
   case NOTE_B1:
@@ -244,6 +253,28 @@ void NewtonColorCirclePlay::Display(int tone, int duration)
     Serial.print("unrecognized pitch");
     Serial.println(tone);
 #endif // DEBUG_SERIAL
+    return 0;
+  }
+
+  return hex_rgb;
+}
+
+void NewtonColorCirclePlay::Display(int tone, int duration)
+{
+  // waits are to deadlines from start, so pin writes do not add up to note duration
+  tick_t start = timeNow();
+  unsigned long hex_rgb = 0;
+  signed int r_old = (signed int) _redValue;
+  signed int g_old = (signed int) _greenValue;
+  signed int b_old = (signed int) _blueValue;
+
+//  Serial.print("NewtonColorCirclePlay::Display : ");
+//  Serial.print(tone);
+
+  hex_rgb = _toneToHex(tone);
+  if (hex_rgb == 0)
+  {
+    // error: just ignore passed sound pitch and do nothing
     return;
   }
 
@@ -285,10 +316,8 @@ void NewtonColorCirclePlay::Display(int tone, int duration)
   //TODO: not support fading for the moment
   if (_fadingRate == 0)
   {// apply immediately the new colors
-    analogWrite(_redPin,_redValue);
-    analogWrite(_greenPin,_greenValue);
-    analogWrite(_bluePin,_blueValue);
-    delay(duration);
+    _writePins(_redValue, _greenValue, _blueValue);
+    timeSleepUntil(start + TIME_MS(duration));
   }
   else
   {
@@ -302,17 +331,13 @@ void NewtonColorCirclePlay::Display(int tone, int duration)
 
     for (int i=0; i < steps; i++)
     {
-      analogWrite(_redPin,  r_old + (i*r_step));
-      analogWrite(_greenPin,g_old + (i*g_step));
-      analogWrite(_bluePin, b_old + (i*b_step));
-      delay(FADE_STEP);
+      _writePins(r_old + (i*r_step), g_old + (i*g_step), b_old + (i*b_step));
+      timeSleepUntil(start + TIME_MS((long)(i + 1) * FADE_STEP));
     }
 
-    analogWrite(_redPin,_redValue);
-    analogWrite(_greenPin,_greenValue);
-    analogWrite(_bluePin,_blueValue);
+    _writePins(_redValue, _greenValue, _blueValue);
 
-    delay(duration - fade_duration);
+    timeSleepUntil(start + TIME_MS(duration));
   }
 }
 
@@ -356,8 +381,122 @@ void NewtonColorCirclePlay::SetRGB(int r, int g, int b)
     return;
   }
 
-  analogWrite(_redPin,_redValue);
-  analogWrite(_greenPin,_greenValue);
-  analogWrite(_bluePin,_blueValue);
+  _writePins(_redValue, _greenValue, _blueValue);
+}
+
+void NewtonColorCirclePlay::setOutput(uint8_t *rgb)
+{
+  _out = rgb;
+}
+
+void NewtonColorCirclePlay::setCalibration(LedCalibration *cal)
+{
+  _calibration = cal;
 }
 
+// write PWM values (already inverted for common anode) correcting them if calibrated
+// (only with LED_CALIBRATION in build flags)
+void NewtonColorCirclePlay::_writePins(int r, int g, int b)
+{
+#ifdef LED_CALIBRATION
+  if (_calibration != NULL)
+  {
+    uint8_t rgb[3] = { (uint8_t)r, (uint8_t)g, (uint8_t)b };
+    if (_common_rgb_type == COMMON_ANODE)
+    {
+      rgb[0] = 0xFF - rgb[0];
+      rgb[1] = 0xFF - rgb[1];
+      rgb[2] = 0xFF - rgb[2];
+    }
+    _calibration->apply(rgb);
+    if (_common_rgb_type == COMMON_ANODE)
+    {
+      rgb[0] = 0xFF - rgb[0];
+      rgb[1] = 0xFF - rgb[1];
+      rgb[2] = 0xFF - rgb[2];
+    }
+    r = rgb[0];
+    g = rgb[1];
+    b = rgb[2];
+  }
+#endif // LED_CALIBRATION
+
+  analogWrite(_redPin, r);
+  analogWrite(_greenPin, g);
+  analogWrite(_bluePin, b);
+}
+
+// sigma-delta: 8.8 intensity to 8 bits, error carried to next Render() of the channel
+uint8_t NewtonColorCirclePlay::_dither8(uint8_t channel, unsigned int value16)
+{
+  value16 += _dither_err[channel];
+  _dither_err[channel] = value16 & 0xFF;
+  return value16 >> 8;
+}
+
+void NewtonColorCirclePlay::setDither(bool enable)
+{
+  _dither = enable;
+  _dither_err[0] = _dither_err[1] = _dither_err[2] = 0;
+}
+
+void NewtonColorCirclePlay::Flash(int tone, int duration, tick_t currTime)
+{
+  unsigned long hex_rgb = _toneToHex(tone);
+  if (hex_rgb == 0)
+  {
+    // error: just ignore passed sound pitch and do nothing
+    return;
+  }
+
+  _flash_rgb = hex_rgb;
+  _flash_start = currTime;
+  _flash_duration = duration;
+}
+
+void NewtonColorCirclePlay::Render(tick_t currTime)
+{
+  LATENCY_PROBE(PROBE_COLOR_RENDER);
+
+  tick_t elapsed = timeElapsed(currTime, _flash_start);
+  int r = 0, g = 0, b = 0;
+
+  if (elapsed < TIME_MS((unsigned long)_flash_duration))
+  {
+    r = (_flash_rgb & RED_MASK) >> RED_SHIFT;
+    g = (_flash_rgb & GREEN_MASK) >> GREEN_SHIFT;
+    b = (_flash_rgb & BLUE_MASK) >> BLUE_SHIFT;
+
+    // fade in from off over fadingRate % of note duration
+    tick_t fade_duration = TIME_MS((unsigned long)_flash_duration * _fadingRate / 100);
+    if ((elapsed < fade_duration) && (_dither))
+    {
+      r = _dither8(0, timeScale16(r, elapsed, fade_duration));
+      g = _dither8(1, timeScale16(g, elapsed, fade_duration));
+      b = _dither8(2, timeScale16(b, elapsed, fade_duration));
+    }
+    else if (elapsed < fade_duration)
+    {
+      r = timeScale16(r, elapsed, fade_duration) >> 8;
+      g = timeScale16(g, elapsed, fade_duration) >> 8;
+      b = timeScale16(b, elapsed, fade_duration) >> 8;
+    }
+  }
+  else
+  {// flash over: forget it, so that it does not light again once elapsed ticks wrap around
+    _flash_duration = 0;
+    _flash_rgb = 0;
+  }
+
+  if (_out != NULL)
+  {
+    _out[0] = r;
+    _out[1] = g;
+    _out[2] = b;
+  }
+  else
+  {
+    // pins: SetRGB() handles common anode/cathode
+    SetRGB(r, g, b);
+  }
+}
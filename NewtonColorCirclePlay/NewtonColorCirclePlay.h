@@ -12,6 +12,9 @@
 #define NEWCOLORCIRCLEPLAY_H_INCLUDED
 
 #include "Arduino.h"
+#include "TimeBase.h"
+
+class LedCalibration;
 
 typedef enum
 {
@@ -29,8 +32,26 @@ class NewtonColorCirclePlay
   void Display(int tone, int duration);
   void SetRGB(int r, int g, int b);
 
+  // non blocking note flash: Flash() starts note color (faded in as Display() with fadingRate),
+  // Render() called every loop writes current color (off once duration is over)
+  void Flash(int tone, int duration, tick_t currTime);
+  void Render(tick_t currTime);
+  // render into a 3 bytes R-G-B intensity layer (e.g. of FrameCompositor) instead of pins
+  void setOutput(uint8_t *rgb);
+  // color correction and gamma of pin writes (NULL: none); layers are not corrected.
+  // Applied only if LED_CALIBRATION is defined in build flags (-DLED_CALIBRATION): the
+  // LedCalibration library is not needed otherwise, and cal is ignored
+  void setCalibration(LedCalibration *cal);
+  // Render() fade in 8.8 fixed point, sigma-delta dithered to 8 bits (call Render() every 1-2ms);
+  // Display() keeps 8-bit steps, its 10ms blocking steps are too slow to dither without flicker
+  void setDither(bool enable);
+
   private:
 
+  unsigned long _toneToHex(int tone);
+  void _writePins(int r, int g, int b);
+  uint8_t _dither8(uint8_t channel, unsigned int value16);
+
   // RGB led pin
   int _redPin;
   int _greenPin;
@@ -47,6 +68,17 @@ class NewtonColorCirclePlay
   int _redValue;
   int _blueValue;
   int _greenValue;
+
+  // layer where to render (NULL: pins) and current flash
+  uint8_t *_out;
+  unsigned long _flash_rgb;
+  tick_t _flash_start;
+  int _flash_duration;
+
+  LedCalibration *_calibration;
+
+  bool _dither;
+  uint8_t _dither_err[3];
 };
 
 #endif NEWCOLORCIRCLEPLAY_H_INCLUDED
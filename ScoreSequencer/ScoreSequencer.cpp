@@ -0,0 +1,229 @@
+/*
+  ScoreSequencer.cpp - library to stream a compact melody score stored in flash
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+*/
+
+#include "ScoreSequencer.h"
+
+#define SCORE_QUEUE_MASK (SCORE_QUEUE_SIZE - 1)
+
+// repeat counter value when repeat end has not been reached yet
+#define REPEAT_NOT_STARTED 0xFF
+
+ScoreSequencer::ScoreSequencer(const uint8_t *score)
+{
+  _score = score;
+
+  // parse header: root, tick and scale pattern turned into cumulative offsets
+  _root = pgm_read_byte(_score);
+  _tick = pgm_read_byte(_score + 1) | ((unsigned int)pgm_read_byte(_score + 2) << 8);
+  _scale_size = pgm_read_byte(_score + 3);
+  _events = SCORE_HEADER_SIZE + _scale_size;
+  // note: an empty or too long scale pattern makes the score invalid, start() does nothing
+  if (_scale_size > SCORE_SCALE_MAX)
+    _scale_size = 0;
+
+  uint8_t cum = 0;
+  for (int i = 0; i < _scale_size; i++)
+  {
+    _scale_cum[i] = cum;
+    cum += pgm_read_byte(_score + SCORE_HEADER_SIZE + i);
+  }
+  // one octave of degrees moves by the whole pattern
+  _span = cum;
+
+  _listeners = 0;
+  _playing = false;
+  _ended = true;
+  _loop = false;
+  _next_time = 0;
+  _rewind();
+}
+
+bool ScoreSequencer::attach(score_callback_t callback, unsigned int lead)
+{
+  if (_listeners == SCORE_MAX_LISTENERS)
+    return false;
+
+  _listener[_listeners].callback = callback;
+  _listener[_listeners].lead = lead;
+  _listener[_listeners].idx = _tail;
+  _listeners++;
+  return true;
+}
+
+// move decoder back to first event
+void ScoreSequencer::_rewind()
+{
+  _pos = _events;
+  _dur = 0;
+  _repeat_top = 0;
+}
+
+void ScoreSequencer::start(tick_t currTime, bool loop)
+{
+  // invalid score: degrees cannot be mapped on the scale
+  if (_scale_size == 0)
+    return;
+
+  _rewind();
+  _head = _tail = 0;
+  for (int i = 0; i < _listeners; i++)
+  {
+    _listener[i].idx = 0;
+  }
+
+  // leave time to listeners with a lead to be notified of first note
+  unsigned int max_lead = 0;
+  for (int i = 0; i < _listeners; i++)
+  {
+    if (_listener[i].lead > max_lead)
+      max_lead = _listener[i].lead;
+  }
+  _next_time = currTime + TIME_MS(max_lead);
+
+  _loop = loop;
+  _ended = false;
+  _playing = true;
+}
+
+void ScoreSequencer::stop()
+{
+  _playing = false;
+  _ended = true;
+}
+
+bool ScoreSequencer::isPlaying()
+{
+  return _playing;
+}
+
+uint8_t ScoreSequencer::_readByte()
+{
+  return pgm_read_byte(_score + _pos++);
+}
+
+// decode events till next note and push it in queue; return false at end of score
+// (or if a whole looped pass has no note)
+bool ScoreSequencer::_decodeNext()
+{
+  bool rewound = false;
+
+  while (true)
+  {
+    uint8_t ev = _readByte();
+
+    if ((ev & 0x80) == SCORE_NOTE)
+    {
+      if (ev & SCORE_NOTE_DUR)
+      {
+        _dur += (int8_t)_readByte();
+      }
+
+      uint8_t degree = ev & SCORE_DEGREE_MASK;
+      score_event_t *q = &_queue[_tail & SCORE_QUEUE_MASK];
+      q->note = _root + (degree / _scale_size) * _span + _scale_cum[degree % _scale_size];
+      q->start = _next_time;
+      q->duration = (unsigned long)_dur * _tick;
+      _tail++;
+
+      _next_time += TIME_MS((unsigned long)_dur * _tick);
+      return true;
+    }
+    else if ((ev & 0xC0) == SCORE_REST)
+    {
+      if (ev & SCORE_REST_DUR)
+      {
+        _dur += (int8_t)_readByte();
+      }
+      _next_time += TIME_MS((unsigned long)_dur * _tick);
+    }
+    else if (ev == SCORE_REPEAT)
+    {
+      // mark where to jump back and duration to restore (deltas are relative to it)
+      if (_repeat_top < SCORE_REPEAT_DEPTH)
+      {
+        _repeat[_repeat_top].pos = _pos;
+        _repeat[_repeat_top].dur = _dur;
+        _repeat[_repeat_top].count = REPEAT_NOT_STARTED;
+        _repeat_top++;
+      }
+    }
+    else if (ev == SCORE_REPEAT_END)
+    {
+      uint8_t n = _readByte();
+      if (_repeat_top > 0)
+      {
+        if (_repeat[_repeat_top - 1].count == REPEAT_NOT_STARTED)
+        {
+          _repeat[_repeat_top - 1].count = n;
+        }
+        if (_repeat[_repeat_top - 1].count > 0)
+        {
+          _repeat[_repeat_top - 1].count--;
+          _pos = _repeat[_repeat_top - 1].pos;
+          _dur = _repeat[_repeat_top - 1].dur;
+        }
+        else
+        {
+          _repeat_top--;
+        }
+      }
+    }
+    else
+    {
+      // SCORE_END (or unknown event): restart or stop decoding
+      if ((!_loop) || (rewound))
+        return false;
+      _rewind();
+      rewound = true;
+    }
+  }
+}
+
+void ScoreSequencer::update(tick_t currTime)
+{
+  if (!_playing)
+    return;
+
+  // keep queue full: events are decoded ahead, listeners are notified when due
+  while ((!_ended) && ((uint8_t)(_tail - _head) < SCORE_QUEUE_SIZE))
+  {
+    if (!_decodeNext())
+      _ended = true;
+  }
+
+  for (int i = 0; i < _listeners; i++)
+  {
+    while (_listener[i].idx != _tail)
+    {
+      score_event_t *q = &_queue[_listener[i].idx & SCORE_QUEUE_MASK];
+      if (!timeReached(currTime, q->start - TIME_MS(_listener[i].lead)))
+        break;
+      _listener[i].callback(q);
+      _listener[i].idx++;
+    }
+  }
+
+  // free events already notified to all listeners
+  while (_head != _tail)
+  {
+    bool pending = false;
+    for (int i = 0; i < _listeners; i++)
+    {
+      if (_listener[i].idx == _head)
+        pending = true;
+    }
+    if (pending)
+      break;
+    _head++;
+  }
+
+  // stop once last event has been notified and played
+  if ((_ended) && (_head == _tail) && (timeReached(currTime, _next_time)))
+  {
+    _playing = false;
+  }
+}
@@ -0,0 +1,140 @@
+/*
+  ScoreSequencer.h - library to stream a compact melody score stored in flash
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  A melody is stored in PROGMEM as a byte stream generated by extras/scorec.cpp
+  from a text score; it is read one event at a time, so RAM used does not depend
+  on song length. Each event start time is computed from song start (and not from
+  when the previous one has been handled) so there is no timing drift.
+*/
+
+#ifndef SCORESEQUENCER_H_INCLUDED
+#define SCORESEQUENCER_H_INCLUDED
+
+#ifdef ARDUINO
+#include "Arduino.h"
+#else
+// host build: only format definitions are used (e.g. by extras/scorec.cpp)
+#include <stdint.h>
+#include <stddef.h>
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#endif // ARDUINO
+
+#include "TimeBase.h"
+
+/* Score format (all values are bytes)
+
+  header:
+    root        index of scale root in scale_chromatic[] (see scales.h, e.g. OCTAVE_4_IDX + C_OFFSET)
+    tick_lo     duration unit in ms (16 bit, little endian)
+    tick_hi
+    size        number of intervals in scale pattern (e.g. DIATONIC_SIZE, 1..SCORE_SCALE_MAX)
+    interval[size]  scale pattern, same values of scales.h offsets (e.g. ionic_offset);
+                    their sum is the step of one octave of degrees (12 for usual scales)
+
+  events:
+    0Dxxxxxx    note: x = scale degree above root (0..63)
+    10Dxxxxx    rest
+                D = duration changed: followed by a signed byte, delta (in ticks)
+                    from previous note/rest duration
+    0xC0        repeat start
+    0xC1 n      repeat end: jump back to repeat start other n times
+    0xFF        end of score
+*/
+#define SCORE_NOTE        0x00
+#define SCORE_NOTE_DUR    0x40
+#define SCORE_DEGREE_MASK 0x3F
+#define SCORE_REST        0x80
+#define SCORE_REST_DUR    0x20
+#define SCORE_REPEAT      0xC0
+#define SCORE_REPEAT_END  0xC1
+#define SCORE_END         0xFF
+
+#define SCORE_HEADER_SIZE 4
+// max intervals in scale pattern
+#define SCORE_SCALE_MAX   12
+
+// decoded events kept ahead of time (power of 2)
+#define SCORE_QUEUE_SIZE    4
+// max nested repeat
+#define SCORE_REPEAT_DEPTH  2
+// max listeners (e.g. sound, color and led)
+#define SCORE_MAX_LISTENERS 3
+
+typedef struct
+{
+  uint8_t note;            // index in scale_chromatic[]
+  tick_t start;            // time (TimeBase ticks) when note has to be played
+  unsigned long duration;  // ms (up to 255 ticks of 65535 ms)
+} score_event_t;
+
+typedef void (*score_callback_t)(const score_event_t *ev);
+
+class ScoreSequencer
+{
+  public:
+    // score: byte stream in PROGMEM
+    ScoreSequencer(const uint8_t *score);
+
+    // register a listener called 'lead' ms before each note start (e.g. to begin a color fade)
+    // return false if too many listeners
+    bool attach(score_callback_t callback, unsigned int lead);
+
+    // does nothing if the score is invalid (scale pattern in header empty or longer than
+    // SCORE_SCALE_MAX); a looped score with no note stops at the end of its first pass
+    void start(tick_t currTime, bool loop);
+    void stop();
+    bool isPlaying();
+
+    // decode ahead and notify due events: call it often (at least once per note)
+    void update(tick_t currTime);
+
+  private:
+    const uint8_t *_score;
+
+    // scale pattern from header: cumulative offsets from root for each degree
+    uint8_t _root;
+    uint8_t _scale_size;
+    uint8_t _scale_cum[SCORE_SCALE_MAX];
+    uint8_t _span;
+    unsigned int _events;
+    unsigned int _tick;
+
+    // decoder state
+    unsigned int _pos;
+    uint8_t _dur;
+    tick_t _next_time;
+    bool _loop;
+    bool _ended;
+    bool _playing;
+
+    struct
+    {
+      unsigned int pos;
+      uint8_t dur;
+      uint8_t count;
+    } _repeat[SCORE_REPEAT_DEPTH];
+    uint8_t _repeat_top;
+
+    // decoded events not yet notified to every listener
+    score_event_t _queue[SCORE_QUEUE_SIZE];
+    uint8_t _head;
+    uint8_t _tail;
+
+    struct
+    {
+      score_callback_t callback;
+      unsigned int lead;
+      uint8_t idx;
+    } _listener[SCORE_MAX_LISTENERS];
+    uint8_t _listeners;
+
+    uint8_t _readByte();
+    void _rewind();
+    bool _decodeNext();
+};
+
+#endif // SCORESEQUENCER_H_INCLUDED
@@ -0,0 +1,142 @@
+/*
+  check_score.cpp - host check of ScoreSequencer decoding, timing and malformed scores
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Build and run on PC (not part of the Arduino library):
+    g++ -O2 -I.. -I../../TimeBase check_score.cpp ../ScoreSequencer.cpp -o check_score
+    ./check_score
+
+  Small scores are played on a simulated clock (update() every STEP_MS) and checked:
+    - melody with a repeat: notes, start times computed from song start, end of play
+    - header with empty or too long scale pattern: rejected, start() does nothing
+    - scale pattern not spanning an octave: degrees above it step by the pattern sum
+    - long note (127 ticks of 1 s): duration not truncated to 16 bit
+    - looped scores with no note (rests only, end only): update() returns and play stops
+*/
+
+#include <stdio.h>
+
+#include "ScoreSequencer.h"
+
+#define STEP_MS  7
+#define MAX_MS   20000UL
+
+#define MAX_NOTES 16
+
+static score_event_t played[MAX_NOTES];
+static int played_cnt;
+static int failures;
+
+static void on_note(const score_event_t *ev)
+{
+  if (played_cnt < MAX_NOTES)
+    played[played_cnt] = *ev;
+  played_cnt++;
+}
+
+static void check(bool ok, const char *what)
+{
+  printf("%-50s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok)
+    failures++;
+}
+
+// play score till it stops (or MAX_MS); return ms when it stopped
+static unsigned long play(const uint8_t *score, bool loop)
+{
+  ScoreSequencer seq(score);
+  seq.attach(on_note, 0);
+  played_cnt = 0;
+
+  seq.start(0, loop);
+  unsigned long t = 0;
+  while ((seq.isPlaying()) && (t < MAX_MS))
+  {
+    seq.update(t);
+    t += STEP_MS;
+  }
+  return t;
+}
+
+// C4 ionic, tick 100ms: [ 0:2 2:1 ]x2 r:1 4:3
+static const uint8_t melody[] PROGMEM = {
+  39, 100, 0, 7,  2, 2, 1, 2, 2, 2, 1,
+  0xC0, 0x40, 2, 0x42, 0xFF, 0xC1, 1, 0x80, 0x44, 2, 0xFF,
+};
+
+static const uint8_t empty_scale[] PROGMEM = {
+  39, 100, 0, 0,
+  0x40, 2, 0x41, 0xFF,
+};
+
+static const uint8_t long_scale[] PROGMEM = {
+  39, 100, 0, 13,  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0x40, 2, 0x41, 0xFF,
+};
+
+// 2 intervals summing to 5 semitones: degrees 1, 2, 3 -> +2, +5, +7
+static const uint8_t short_span[] PROGMEM = {
+  39, 100, 0, 2,  2, 3,
+  0x41, 1, 0x02, 0x03, 0xFF,
+};
+
+// tick 1000 ms, 127 ticks: 127000 ms
+static const uint8_t long_note[] PROGMEM = {
+  39, 0xE8, 0x03, 7,  2, 2, 1, 2, 2, 2, 1,
+  0x40, 0x7F, 0xFF,
+};
+
+static const uint8_t rests_only[] PROGMEM = {
+  39, 100, 0, 7,  2, 2, 1, 2, 2, 2, 1,
+  0xA0, 4, 0x80, 0xFF,
+};
+
+static const uint8_t end_only[] PROGMEM = {
+  39, 100, 0, 7,  2, 2, 1, 2, 2, 2, 1,
+  0xFF,
+};
+
+int main()
+{
+  // degree 0 -> root, 2 -> +4, 4 -> +7 semitones
+  static const uint8_t notes[] = { 39, 43, 39, 43, 46 };
+  static const unsigned long starts[] = { 0, 200, 300, 500, 700 };
+  static const unsigned int durations[] = { 200, 100, 200, 100, 300 };
+
+  unsigned long end = play(melody, false);
+  bool ok = (played_cnt == 5);
+  for (int i = 0; (ok) && (i < 5); i++)
+  {
+    ok = (played[i].note == notes[i]) && (played[i].start == starts[i]) &&
+         (played[i].duration == durations[i]);
+  }
+  check(ok, "melody: notes, start times and durations");
+  check((end >= 1000) && (end < 1000 + STEP_MS * 2), "melody: stops once last note is over");
+
+  end = play(empty_scale, false);
+  check((played_cnt == 0) && (end == 0), "empty scale pattern: not played");
+
+  end = play(long_scale, false);
+  check((played_cnt == 0) && (end == 0), "too long scale pattern: not played");
+
+  play(short_span, false);
+  check((played_cnt == 3) && (played[0].note == 41) && (played[1].note == 44) &&
+        (played[2].note == 46), "short span scale: octave steps by pattern sum");
+
+  ScoreSequencer seq(long_note);
+  seq.attach(on_note, 0);
+  played_cnt = 0;
+  seq.start(0, false);
+  seq.update(0);
+  check((played_cnt == 1) && (played[0].duration == 127000UL), "long note: duration in ms not truncated");
+
+  end = play(rests_only, true);
+  check((played_cnt == 0) && (end < MAX_MS), "looped score with rests only: stops");
+
+  end = play(end_only, true);
+  check((played_cnt == 0) && (end < MAX_MS), "looped empty score: stops");
+
+  return (failures == 0) ? 0 : 1;
+}
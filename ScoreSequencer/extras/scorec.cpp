@@ -0,0 +1,246 @@
+/*
+  scorec.cpp - host compiler from a text score to ScoreSequencer PROGMEM data
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Build and run on PC (not part of the Arduino library):
+    g++ -O2 -I.. -I../../TimeBase scorec.cpp -o scorec
+    ./scorec melody.txt melody > melody.h
+
+  Text score: tokens separated by spaces or new lines, '#' starts a comment
+    scale ionic     scale pattern, one of scales.h: chromatic ionic doric eolyc frygian
+                    lydian misolydian corsica pentatonic_major pentatonic_minor blues_minor
+    root C4         scale root (B0..DS8, sharp as 'S' or '#')
+    tick 125        duration unit in ms
+    3:2             note: scale degree above root (0..63) ':' duration in ticks (1..255)
+    r:4             rest of 4 ticks
+    [  ...  ]x3     play enclosed events 3 times (max 2 nested)
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <vector>
+#include <string>
+
+#include "ScoreSequencer.h"
+
+typedef struct
+{
+  const char *name;
+  int size;
+  int interval[12];
+} scale_def_t;
+
+// same patterns of scales.h
+static const scale_def_t scales[] = {
+  { "chromatic",        12, { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 } },
+  { "ionic",             7, { 2, 2, 1, 2, 2, 2, 1 } },
+  { "doric",             7, { 2, 1, 2, 2, 2, 1, 2 } },
+  { "eolyc",             7, { 1, 2, 2, 2, 1, 2, 2 } },
+  { "frygian",           7, { 2, 2, 2, 1, 2, 2, 1 } },
+  { "lydian",            7, { 2, 2, 1, 2, 2, 1, 2 } },
+  { "misolydian",        7, { 2, 1, 2, 2, 1, 2, 2 } },
+  { "corsica",           7, { 1, 2, 2, 1, 2, 2, 2 } },
+  { "pentatonic_major",  5, { 2, 2, 3, 2, 3 } },
+  { "pentatonic_minor",  5, { 3, 2, 2, 3, 2 } },
+  { "blues_minor",       6, { 3, 2, 1, 1, 3, 2 } },
+};
+
+// same layout of scale_chromatic[] in scales.h
+#define FULL_CHROMATIC_SIZE 89
+
+static int line_no = 1;
+
+static void fail(const char *msg, const std::string &tok)
+{
+  fprintf(stderr, "line %d: %s '%s'\n", line_no, msg, tok.c_str());
+  exit(1);
+}
+
+// note name (e.g. C4, FS3, A#2, B0) into scale_chromatic[] index
+static int note_index(const std::string &tok)
+{
+  static const int offset[7] = { 9, 11, 0, 2, 4, 5, 7 };   // A B C D E F G
+  size_t i = 0;
+  char letter = toupper(tok[i++]);
+  if ((letter < 'A') || (letter > 'G'))
+    fail("wrong note", tok);
+
+  int off = offset[letter - 'A'];
+  if ((i < tok.size()) && ((toupper(tok[i]) == 'S') || (tok[i] == '#')))
+  {
+    off++;
+    i++;
+  }
+  if ((i >= tok.size()) || !isdigit(tok[i]))
+    fail("missing octave", tok);
+
+  int idx = 1 + (atoi(tok.c_str() + i) - 1) * 12 + off;
+  if ((idx < 0) || (idx >= FULL_CHROMATIC_SIZE))
+    fail("note out of range", tok);
+  return idx;
+}
+
+static std::string next_token(FILE *f)
+{
+  std::string tok;
+  int c;
+
+  while ((c = fgetc(f)) != EOF)
+  {
+    if (c == '#' && tok.empty())
+    {
+      while ((c = fgetc(f)) != EOF && c != '\n')
+        ;
+    }
+    if (c == '\n')
+      line_no++;
+    if ((c == EOF) || isspace(c))
+    {
+      if (!tok.empty())
+        return tok;
+      continue;
+    }
+    tok += (char)c;
+  }
+  return tok;
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc < 3)
+  {
+    fprintf(stderr, "usage: %s score.txt array_name > score.h\n", argv[0]);
+    return 1;
+  }
+  FILE *f = fopen(argv[1], "r");
+  if (f == NULL)
+  {
+    fprintf(stderr, "can not open %s\n", argv[1]);
+    return 1;
+  }
+
+  const scale_def_t *scale = &scales[1];
+  int root = 37;   // C4
+  int tick = 100;
+  int dur = 0;
+  int max_degree = 0;
+  int depth = 0;
+  int notes = 0;
+  std::vector<uint8_t> ev;
+
+  std::string tok;
+  while (!(tok = next_token(f)).empty())
+  {
+    if (tok == "scale")
+    {
+      std::string name = next_token(f);
+      scale = NULL;
+      for (size_t i = 0; i < sizeof(scales) / sizeof(scales[0]); i++)
+      {
+        if (name == scales[i].name)
+          scale = &scales[i];
+      }
+      if (scale == NULL)
+        fail("unknown scale", name);
+      if ((scale->size < 1) || (scale->size > SCORE_SCALE_MAX))
+        fail("wrong scale pattern size", name);
+    }
+    else if (tok == "root")
+    {
+      root = note_index(next_token(f));
+    }
+    else if (tok == "tick")
+    {
+      tick = atoi(next_token(f).c_str());
+      if ((tick <= 0) || (tick > 0xFFFF))
+        fail("wrong tick", tok);
+    }
+    else if (tok == "[")
+    {
+      if (++depth > SCORE_REPEAT_DEPTH)
+        fail("too many nested repeat", tok);
+      ev.push_back(SCORE_REPEAT);
+    }
+    else if ((tok[0] == ']') && (tok.size() > 2) && (tok[1] == 'x'))
+    {
+      int times = atoi(tok.c_str() + 2);
+      if ((depth == 0) || (times < 1) || (times > 255))
+        fail("wrong repeat end", tok);
+      depth--;
+      ev.push_back(SCORE_REPEAT_END);
+      ev.push_back(times - 1);
+    }
+    else
+    {
+      size_t colon = tok.find(':');
+      if (colon == std::string::npos)
+        fail("unknown token", tok);
+
+      int d = atoi(tok.c_str() + colon + 1);
+      if ((d < 1) || (d > 255))
+        fail("wrong duration", tok);
+      int delta = d - dur;
+      if ((delta < -128) || (delta > 127))
+        fail("duration change too large (use an intermediate value)", tok);
+
+      bool is_rest = (tok[0] == 'r');
+      uint8_t code;
+      if (is_rest)
+      {
+        code = SCORE_REST | ((delta != 0) ? SCORE_REST_DUR : 0);
+      }
+      else
+      {
+        int degree = atoi(tok.c_str());
+        if ((degree < 0) || (degree > SCORE_DEGREE_MASK))
+          fail("wrong degree", tok);
+        max_degree = (degree > max_degree) ? degree : max_degree;
+        code = SCORE_NOTE | degree | ((delta != 0) ? SCORE_NOTE_DUR : 0);
+        notes++;
+      }
+      ev.push_back(code);
+      if (delta != 0)
+        ev.push_back((uint8_t)(int8_t)delta);
+      dur = d;
+    }
+  }
+  fclose(f);
+
+  if (depth != 0)
+    fail("missing repeat end", "]");
+  if (notes == 0)
+    fail("no notes in score", argv[1]);
+
+  int span = 0;
+  for (int i = 0; i < scale->size; i++)
+    span += scale->interval[i];
+  int top = root + (max_degree / scale->size) * span;
+  for (int i = 0; i < max_degree % scale->size; i++)
+    top += scale->interval[i];
+  if (top >= FULL_CHROMATIC_SIZE)
+    fail("highest note out of scale_chromatic[]", scale->name);
+
+  ev.push_back(SCORE_END);
+
+  // emit header
+  printf("// generated by scorec from %s: do not edit\n", argv[1]);
+  printf("const uint8_t %s[] PROGMEM = {\n", argv[2]);
+  printf("  %d, 0x%02X, 0x%02X, %d,    // root, tick %d ms, %s\n ",
+         root, tick & 0xFF, tick >> 8, scale->size, tick, scale->name);
+  for (int i = 0; i < scale->size; i++)
+    printf(" %d,", scale->interval[i]);
+  for (size_t i = 0; i < ev.size(); i++)
+  {
+    if (i % 12 == 0)
+      printf("\n ");
+    printf(" 0x%02X,", ev[i]);
+  }
+  printf("\n};\n");
+
+  fprintf(stderr, "%d notes, %d bytes\n", notes, (int)(SCORE_HEADER_SIZE + scale->size + ev.size()));
+  return 0;
+}
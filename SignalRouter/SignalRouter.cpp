@@ -0,0 +1,219 @@
+/*
+  SignalRouter.cpp - library to route sensors to leds and notes with a table in flash
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "SignalRouter.h"
+#include "SoftPressSensor.h"
+#include "FadingPatternLed.h"
+#include "NewtonColorCirclePlay.h"
+#include "ChordGenerator.h"
+
+#define NO_NOTE -1
+
+SignalRouter::SignalRouter()
+{
+  _routes = NULL;
+  _count = 0;
+  _sources_cnt = 0;
+  _pitches = NULL;
+  _pitches_cnt = 0;
+  _callback = NULL;
+
+  for (uint8_t i = 0; i < ROUTER_MAX_SOURCES; i++)
+  {
+    _sources[i] = NULL;
+    _value[i] = 0;
+    _pressed[i] = false;
+  }
+  for (uint8_t i = 0; i < ROUTER_MAX_LEDS; i++)
+    _leds[i] = NULL;
+  for (uint8_t i = 0; i < ROUTER_MAX_COLORS; i++)
+    _colors[i] = NULL;
+  for (uint8_t i = 0; i < ROUTER_MAX_NOTE_ROUTES; i++)
+    _last_note[i] = NO_NOTE;
+  for (uint8_t i = 0; i < ROUTER_MAX_LAYERS; i++)
+    _layers[i] = NULL;
+  for (uint8_t i = 0; i < ROUTER_MAX_CURVES; i++)
+    _curves[i] = NULL;
+  for (uint8_t i = 0; i < ROUTER_MAX_SCALES; i++)
+    _scales[i] = NULL;
+}
+
+void SignalRouter::begin(const route_t *routes_P, uint8_t count)
+{
+  _routes = routes_P;
+  _count = count;
+  for (uint8_t i = 0; i < ROUTER_MAX_NOTE_ROUTES; i++)
+    _last_note[i] = NO_NOTE;
+}
+
+void SignalRouter::setSource(uint8_t idx, SoftPressSensor *sensor)
+{
+  if (idx >= ROUTER_MAX_SOURCES)
+    return;
+  _sources[idx] = sensor;
+  if (idx >= _sources_cnt)
+    _sources_cnt = idx + 1;
+}
+
+void SignalRouter::setLed(uint8_t idx, FadingPatternLed *led)
+{
+  if (idx < ROUTER_MAX_LEDS)
+    _leds[idx] = led;
+}
+
+void SignalRouter::setColor(uint8_t idx, NewtonColorCirclePlay *color)
+{
+  if (idx < ROUTER_MAX_COLORS)
+    _colors[idx] = color;
+}
+
+void SignalRouter::setLayer(uint8_t idx, uint8_t *target)
+{
+  if (idx < ROUTER_MAX_LAYERS)
+    _layers[idx] = target;
+}
+
+void SignalRouter::setCurve(uint8_t idx, const uint8_t *lut_P)
+{
+  if (idx < ROUTER_MAX_CURVES)
+    _curves[idx] = lut_P;
+}
+
+void SignalRouter::setScale(uint8_t idx, ChordGenerator *scale)
+{
+  if (idx < ROUTER_MAX_SCALES)
+    _scales[idx] = scale;
+}
+
+void SignalRouter::setPitches(const int *pitches, uint8_t count)
+{
+  _pitches = pitches;
+  _pitches_cnt = count;
+}
+
+void SignalRouter::setCallback(route_callback_t cb)
+{
+  _callback = cb;
+}
+
+int SignalRouter::_input(uint8_t source, uint8_t input)
+{
+  SoftPressSensor *sensor = _sources[source];
+
+  switch (input)
+  {
+    case ROUTE_IN_VALUE:
+      return _value[source];
+    case ROUTE_IN_PRESSED:
+      return _pressed[source];
+    case ROUTE_IN_VELOCITY:
+      return sensor->getVelocity();
+    case ROUTE_IN_AFTERTOUCH:
+      return sensor->getAftertouch();
+    case ROUTE_IN_PEAK:
+      return sensor->getPeak();
+  }
+  return 0;
+}
+
+int SignalRouter::_transform(const route_t *route, int value)
+{
+  long v;
+  int shift;
+
+  switch (route->transform)
+  {
+    case ROUTE_THRESHOLD:
+      return (value > route->p1) ? 1 : 0;
+
+    case ROUTE_SCALE:
+      v = (((long)value * route->p1) >> 8) + route->p2;
+      return constrain(v, 0, 32767);
+
+    case ROUTE_CURVE:
+      if ((route->p1 < 0) || (route->p1 >= ROUTER_MAX_CURVES) || (_curves[route->p1] == NULL))
+        return value;
+      // shift by a negative or too large count is undefined: keep it in int range (16 bit on AVR)
+      shift = constrain(route->p2, 0, 15);
+      v = value >> shift;
+      v = constrain(v, 0, 255);
+      return pgm_read_byte(_curves[route->p1] + v);
+
+    case ROUTE_QUANTIZE:
+      if ((!_pressed[route->source]) || (route->p1 < 0) || (route->p1 >= ROUTER_MAX_SCALES) ||
+          (_scales[route->p1] == NULL) || (route->p2 <= 0))
+        return NO_NOTE;
+      return _scales[route->p1]->note(value / route->p2);
+  }
+  return value;
+}
+
+void SignalRouter::_sink(const route_t *route, uint8_t note_slot, int value, tick_t currTime)
+{
+  uint8_t t = route->target;
+
+  switch (route->sink)
+  {
+    case ROUTE_TO_LED:
+      if ((t < ROUTER_MAX_LEDS) && (_leds[t] != NULL))
+        _leds[t]->exciting = (value != 0);
+      break;
+
+    case ROUTE_TO_LAYER:
+      if ((t < ROUTER_MAX_LAYERS) && (_layers[t] != NULL))
+        *_layers[t] = (value > 255) ? 255 : ((value < 0) ? 0 : value);
+      break;
+
+    case ROUTE_TO_NOTE:
+      if ((note_slot >= ROUTER_MAX_NOTE_ROUTES) || (t >= ROUTER_MAX_COLORS) || (_colors[t] == NULL) ||
+          (value == _last_note[note_slot]))
+        break;
+      // flash on note change of this route only (other routes may share the color),
+      // released notes fade as Render() goes on
+      _last_note[note_slot] = value;
+      if ((value >= 0) && (value < _pitches_cnt) && (_pitches != NULL))
+        _colors[t]->Flash(_pitches[value], route->sink_param, currTime);
+      break;
+
+    case ROUTE_TO_CALLBACK:
+      if (_callback != NULL)
+        _callback(t, value);
+      break;
+  }
+}
+
+void SignalRouter::update(tick_t currTime)
+{
+  // each source read once, whatever the number of routes using it
+  for (uint8_t i = 0; i < _sources_cnt; i++)
+  {
+    if (_sources[i] == NULL)
+      continue;
+    int value = _sources[i]->read();
+    _value[i] = (value == (int)NOT_CALIBRATED) ? 0 : value;
+    _pressed[i] = _sources[i]->isPressed();
+  }
+
+  // one pass on routing table
+  route_t route;
+  uint8_t note_routes = 0;
+  for (uint8_t r = 0; r < _count; r++)
+  {
+    memcpy_P(&route, _routes + r, sizeof(route));
+    // note routes are numbered in table order, whether their source is set or not
+    uint8_t note_slot = note_routes;
+    if (route.sink == ROUTE_TO_NOTE)
+      note_routes++;
+    if ((route.source >= _sources_cnt) || (_sources[route.source] == NULL))
+      continue;
+
+    int value = _input(route.source, route.input);
+    value = _transform(&route, value);
+    _sink(&route, note_slot, value, currTime);
+  }
+}
@@ -0,0 +1,144 @@
+/*
+  SignalRouter.h - library to route sensors to leds and notes with a table in flash
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Instead of if chains in the sketch, each route is a row of a PROGMEM table:
+    { source, input, transform, p1, p2, sink, target, sink_param }
+  e.g. pad 0 excites leds 0 and 1 and plays notes of scale 0 on color 0:
+    const route_t routes[] PROGMEM = {
+      { 0, ROUTE_IN_PRESSED,    ROUTE_NONE,     0,   0, ROUTE_TO_LED,  0,   0 },
+      { 0, ROUTE_IN_PRESSED,    ROUTE_NONE,     0,   0, ROUTE_TO_LED,  1,   0 },
+      { 0, ROUTE_IN_AFTERTOUCH, ROUTE_QUANTIZE, 0,  16, ROUTE_TO_NOTE, 0, 250 },
+    };
+  Objects are registered by index (setSource(), setLed(), ...), then update() once per
+  tick reads each source once and evaluates all routes in one pass: cost is linear
+  with routes and fan-out adds no read.
+
+  transforms (value v of input):
+    ROUTE_NONE      : v
+    ROUTE_THRESHOLD : 1 if v > p1, else 0
+    ROUTE_SCALE     : v * p1 / 256 + p2 (p1 Q8 gain), clamped to [0:32767]
+    ROUTE_CURVE     : lut p1 (setCurve()) of v >> p2 (p2 clamped to [0:15]), saturated to 255
+    ROUTE_QUANTIZE  : degree v / p2 (input units per degree) of scale p1 (setScale()), as
+                      index in scale_chromatic[]; -1 (no note) while source is not pressed
+  sinks (target is the index of registered object):
+    ROUTE_TO_LED      : FadingPatternLed exciting = (value != 0)
+    ROUTE_TO_LAYER    : byte (e.g. FrameCompositor layer channel) = value saturated to 255
+    ROUTE_TO_NOTE     : NewtonColorCirclePlay Flash() of note, for sink_param ms, when note
+                        changes (pitch from table passed to setPitches(), e.g. scale_chromatic;
+                        notes out of the table are ignored); note changes are tracked per route,
+                        for the first ROUTER_MAX_NOTE_ROUTES note routes of the table (others
+                        are ignored)
+    ROUTE_TO_CALLBACK : callback(target, value)
+  Sketch still calls updatePattern()/UpdateDisplay() of leds and Render() of colors.
+*/
+
+#ifndef SIGNALROUTER_H_INCLUDED
+#define SIGNALROUTER_H_INCLUDED
+
+#include "Arduino.h"
+#include "TimeBase.h"
+
+class SoftPressSensor;
+class FadingPatternLed;
+class NewtonColorCirclePlay;
+class ChordGenerator;
+
+#define ROUTER_MAX_SOURCES 16
+#define ROUTER_MAX_LEDS    16
+#define ROUTER_MAX_COLORS  4
+#define ROUTER_MAX_LAYERS  8
+#define ROUTER_MAX_CURVES  4
+#define ROUTER_MAX_SCALES  4
+#define ROUTER_MAX_NOTE_ROUTES 4
+
+typedef enum
+{
+  ROUTE_IN_VALUE,       // read() value (0 while not calibrated)
+  ROUTE_IN_PRESSED,     // isPressed()
+  ROUTE_IN_VELOCITY,    // getVelocity()
+  ROUTE_IN_AFTERTOUCH,  // getAftertouch()
+  ROUTE_IN_PEAK,        // getPeak()
+} route_input_t;
+
+typedef enum
+{
+  ROUTE_NONE,
+  ROUTE_THRESHOLD,
+  ROUTE_SCALE,
+  ROUTE_CURVE,
+  ROUTE_QUANTIZE,
+} route_transform_t;
+
+typedef enum
+{
+  ROUTE_TO_LED,
+  ROUTE_TO_LAYER,
+  ROUTE_TO_NOTE,
+  ROUTE_TO_CALLBACK,
+} route_sink_t;
+
+// one row of routing table (bytes, and 16-bit parameters, to keep the table compact in flash)
+typedef struct
+{
+  uint8_t source;
+  uint8_t input;
+  uint8_t transform;
+  int16_t p1;
+  int16_t p2;
+  uint8_t sink;
+  uint8_t target;
+  int16_t sink_param;
+} route_t;
+
+typedef void (*route_callback_t)(uint8_t target, int value);
+
+class SignalRouter
+{
+  public:
+    SignalRouter();
+
+    // PROGMEM routing table
+    void begin(const route_t *routes_P, uint8_t count);
+
+    void setSource(uint8_t idx, SoftPressSensor *sensor);
+    void setLed(uint8_t idx, FadingPatternLed *led);
+    void setColor(uint8_t idx, NewtonColorCirclePlay *color);
+    void setLayer(uint8_t idx, uint8_t *target);
+    void setCurve(uint8_t idx, const uint8_t *lut_P);
+    void setScale(uint8_t idx, ChordGenerator *scale);
+    void setPitches(const int *pitches, uint8_t count);
+    void setCallback(route_callback_t cb);
+
+    // read sources and evaluate routing table (current time: timeNow())
+    void update(tick_t currTime);
+
+  private:
+    int _input(uint8_t source, uint8_t input);
+    int _transform(const route_t *route, int value);
+    void _sink(const route_t *route, uint8_t note_slot, int value, tick_t currTime);
+
+    const route_t *_routes;
+    uint8_t _count;
+
+    SoftPressSensor *_sources[ROUTER_MAX_SOURCES];
+    uint8_t _sources_cnt;
+    // source values read once per update()
+    int _value[ROUTER_MAX_SOURCES];
+    bool _pressed[ROUTER_MAX_SOURCES];
+
+    FadingPatternLed *_leds[ROUTER_MAX_LEDS];
+    NewtonColorCirclePlay *_colors[ROUTER_MAX_COLORS];
+    // last note of each note route (n-th ROUTE_TO_NOTE row of the table)
+    int _last_note[ROUTER_MAX_NOTE_ROUTES];
+    uint8_t *_layers[ROUTER_MAX_LAYERS];
+    const uint8_t *_curves[ROUTER_MAX_CURVES];
+    ChordGenerator *_scales[ROUTER_MAX_SCALES];
+    const int *_pitches;
+    uint8_t _pitches_cnt;
+    route_callback_t _callback;
+};
+
+#endif // SIGNALROUTER_H_INCLUDED
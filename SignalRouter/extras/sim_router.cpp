@@ -0,0 +1,167 @@
+/*
+  sim_router.cpp - host simulation of a large installation routed by SignalRouter
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Build and run on PC (not part of the Arduino library):
+    g++ -O2 -I../../extras/host -I.. -I../../TimeBase -I../../SoftPressSensor -I../../FadingPatternLed \
+        -I../../NewtonColorCirclePlay -I../../ChordGenerator -I../../music \
+        sim_router.cpp ../SignalRouter.cpp ../../SoftPressSensor/SoftPressSensor.cpp \
+        ../../FadingPatternLed/FadingPatternLed.cpp ../../NewtonColorCirclePlay/NewtonColorCirclePlay.cpp \
+        ../../ChordGenerator/ChordGenerator.cpp \
+        ../../TimeBase/TimeBase.cpp ../../extras/host/Arduino.cpp -o sim_router
+    ./sim_router
+
+  PADS pads drive FANOUT leds each (and pad 0 aftertouch plays notes of a pentatonic
+  scale on a color led), first with the usual sketch code where each led asks its pad
+  (one read() per led), then with the routing table (one read() per pad).
+  For each one: analogRead() calls and virtual time (I/O at 16MHz AVR cost) per tick,
+  and led states differing from the other leds of the same pad (with one read() per led
+  each led sees a different sample, and the moving average runs FANOUT times per tick).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "Arduino.h"
+#include "SoftPressSensor.h"
+#include "FadingPatternLed.h"
+#include "NewtonColorCirclePlay.h"
+#include "ChordGenerator.h"
+#include "SignalRouter.h"
+#include "scales.h"
+
+#define PADS    12
+#define FANOUT  2
+#define LEDS    (PADS * FANOUT)
+#define TICK_MS 10
+#define RUN_MS  60000UL
+
+#define IDLE_VALUE  300
+#define PRESS_VALUE 450
+
+static unsigned long analog_reads;
+
+// pad n pressed 1s every (n + 2)s, after a calibration press of all pads at 1s
+static bool pad_pressed(uint8_t pad, unsigned long t)
+{
+  if ((t >= 1000) && (t < 1500))
+    return true;
+  return ((t % ((pad + 2) * 1000UL)) < 1000);
+}
+
+static int on_analog_read(uint8_t pin)
+{
+  analog_reads++;
+  int noise = (rand() % 5) - 2;
+  return (pad_pressed(pin, millis()) ? PRESS_VALUE : IDLE_VALUE) + noise;
+}
+
+// led n is driven by pad n / FANOUT
+static const route_t routes[] PROGMEM = {
+#define LED_ROUTE(n) { (n) / FANOUT, ROUTE_IN_PRESSED, ROUTE_NONE, 0, 0, ROUTE_TO_LED, (n), 0 }
+  LED_ROUTE(0),  LED_ROUTE(1),  LED_ROUTE(2),  LED_ROUTE(3),  LED_ROUTE(4),  LED_ROUTE(5),
+  LED_ROUTE(6),  LED_ROUTE(7),  LED_ROUTE(8),  LED_ROUTE(9),  LED_ROUTE(10), LED_ROUTE(11),
+  LED_ROUTE(12), LED_ROUTE(13), LED_ROUTE(14), LED_ROUTE(15), LED_ROUTE(16), LED_ROUTE(17),
+  LED_ROUTE(18), LED_ROUTE(19), LED_ROUTE(20), LED_ROUTE(21), LED_ROUTE(22), LED_ROUTE(23),
+  { 0, ROUTE_IN_AFTERTOUCH, ROUTE_QUANTIZE, 0, 16, ROUTE_TO_NOTE, 0, 250 },
+};
+#define ROUTES (sizeof(routes) / sizeof(routes[0]))
+
+// all leds share one profile
+static const FadingPatternProfile led_profile(1500, 500, 1500, 3000, 200);
+
+static void run(bool routed)
+{
+  srand(1);
+  host_set_micros(0);
+  analog_reads = 0;
+
+  SoftPressSensor *pads[PADS];
+  FadingPatternLed *leds[LEDS];
+  for (int i = 0; i < PADS; i++)
+    pads[i] = new SoftPressSensor(i);
+  for (int i = 0; i < LEDS; i++)
+    leds[i] = new FadingPatternLed(20 + i, &led_profile);
+  NewtonColorCirclePlay color(60, 61, 62, 20, COMMON_ANODE);
+  ChordGenerator scale(pentatonic_major, PENTATONIC_SIZE, OCTAVE_4_IDX + C_OFFSET);
+  uint8_t rgb[3];
+  color.setOutput(rgb);
+
+  SignalRouter router;
+  router.begin(routes, ROUTES);
+  for (int i = 0; i < PADS; i++)
+    router.setSource(i, pads[i]);
+  for (int i = 0; i < LEDS; i++)
+    router.setLed(i, leds[i]);
+  router.setColor(0, &color);
+  router.setScale(0, &scale);
+  router.setPitches(scale_chromatic, FULL_CHROMATIC_SIZE);
+
+  unsigned long ticks = 0;
+  unsigned long long busy_us = 0;
+  unsigned long out_of_sync = 0;
+  int last_note = -1;
+
+  for (unsigned long t = 0; t < RUN_MS; t += TICK_MS)
+  {
+    host_set_micros((unsigned long long)t * 1000);
+    unsigned long start = micros();
+
+    if (routed)
+    {
+      router.update(t);
+    }
+    else
+    {
+      // hand coded: each led reads its pad
+      for (int i = 0; i < LEDS; i++)
+      {
+        SoftPressSensor *pad = pads[i / FANOUT];
+        pad->read();
+        leds[i]->exciting = pad->isPressed();
+      }
+      if (pads[0]->isPressed())
+      {
+        int note = scale.note(pads[0]->getAftertouch() / 16);
+        if (note != last_note)
+          color.Flash(scale_chromatic[note], 250, t);
+        last_note = note;
+      }
+      else
+      {
+        last_note = -1;
+      }
+    }
+    color.Render(t);
+
+    busy_us += micros() - start;
+    ticks++;
+
+    // leds of the same pad must show the same state
+    for (int i = 0; i < LEDS; i++)
+    {
+      if (leds[i]->exciting != leds[(i / FANOUT) * FANOUT]->exciting)
+        out_of_sync++;
+    }
+  }
+
+  printf("%-11s %2d pads -> %2d leds: %5.1f analogRead/tick, %6.0f us/tick, %lu led states out of sync\n",
+         routed ? "routed" : "hand coded", PADS, LEDS, (double)analog_reads / ticks,
+         (double)busy_us / ticks, out_of_sync);
+
+  for (int i = 0; i < PADS; i++)
+    delete pads[i];
+  for (int i = 0; i < LEDS; i++)
+    delete leds[i];
+}
+
+int main()
+{
+  host_on_analog_read(on_analog_read);
+
+  run(false);
+  run(true);
+  return 0;
+}
@@ -0,0 +1,119 @@
+/*
+  ExtAdcSource.cpp - external multi-channel ADC backends for "Soft Pressure Sensor"
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "ExtAdcSource.h"
+
+// MCP3208 command: start bit, single ended, channel (3 bits) across first two bytes
+#define MCP3208_START      0x04
+#define MCP3208_SINGLE     0x02
+
+// ADS1115 registers and config fields
+#define ADS1115_REG_CONVERSION 0x00
+#define ADS1115_REG_CONFIG     0x01
+#define ADS1115_OS_START       0x8000
+#define ADS1115_MUX_SINGLE     0x4000   // AINx vs GND, channel in bits 13:12
+#define ADS1115_MUX_SHIFT      12
+#define ADS1115_PGA_4V         0x0200   // +/-4.096V full scale
+#define ADS1115_MODE_SINGLE    0x0100
+#define ADS1115_DR_860SPS      0x00E0
+#define ADS1115_COMP_DISABLE   0x0003
+
+Mcp3208Source::Mcp3208Source(PressSpiBus *bus, uint8_t channels)
+{
+  _bus = bus;
+  _channels = min(channels, MCP3208_CHANNELS);
+  for (int i = 0; i < MCP3208_CHANNELS; i++)
+  {
+    _value[i] = 0;
+  }
+}
+
+void Mcp3208Source::update()
+{
+  _bus->beginTransaction();
+  for (int ch = 0; ch < _channels; ch++)
+  {
+    // chip select has to toggle to start each conversion
+    _bus->select(true);
+    _bus->transfer(MCP3208_START | MCP3208_SINGLE | (ch >> 2));
+    uint8_t hi = _bus->transfer((ch & 0x03) << 6);
+    uint8_t lo = _bus->transfer(0);
+    _bus->select(false);
+
+    _value[ch] = ((hi & 0x0F) << 8) | lo;
+  }
+  _bus->endTransaction();
+}
+
+long Mcp3208Source::value(uint8_t channel)
+{
+  return (channel < _channels) ? _value[channel] : 0;
+}
+
+long Mcp3208Source::fullScale()
+{
+  return MCP3208_FULL_SCALE;
+}
+
+Ads1115Source::Ads1115Source(PressI2cBus *bus, uint8_t addr, uint8_t channels)
+{
+  _bus = bus;
+  _addr = addr;
+  _channels = constrain(channels, 1, ADS1115_CHANNELS);
+  for (int i = 0; i < ADS1115_CHANNELS; i++)
+  {
+    _value[i] = 0;
+  }
+  _converting = 0;
+  _start_time = 0;
+  _started = false;
+}
+
+bool Ads1115Source::_startConversion(uint8_t channel)
+{
+  uint16_t config = ADS1115_OS_START | ADS1115_MUX_SINGLE | ((uint16_t)channel << ADS1115_MUX_SHIFT) |
+                    ADS1115_PGA_4V | ADS1115_MODE_SINGLE | ADS1115_DR_860SPS | ADS1115_COMP_DISABLE;
+
+  _started = _bus->writeRegister(_addr, ADS1115_REG_CONFIG, config);
+  _start_time = micros();
+  return _started;
+}
+
+void Ads1115Source::update()
+{
+  if (!_started)
+  {
+    _startConversion(_converting);
+    return;
+  }
+
+  // conversion still running: keep previous values, do not block
+  if (micros() - _start_time < ADS1115_CONVERSION_US)
+    return;
+
+  uint16_t raw;
+  if (_bus->readRegister(_addr, ADS1115_REG_CONVERSION, &raw))
+  {
+    // single ended: negative results are only noise around ground
+    _value[_converting] = max((int16_t)raw, 0);
+  }
+
+  // pipeline: next channel converts while values are processed
+  _converting = (_converting + 1) % _channels;
+  _startConversion(_converting);
+}
+
+long Ads1115Source::value(uint8_t channel)
+{
+  return (channel < _channels) ? _value[channel] : 0;
+}
+
+long Ads1115Source::fullScale()
+{
+  return ADS1115_FULL_SCALE;
+}
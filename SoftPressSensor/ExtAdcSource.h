@@ -0,0 +1,67 @@
+/*
+  ExtAdcSource.h - external multi-channel ADC backends for "Soft Pressure Sensor"
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Mcp3208Source: 8 channels, 12-bit, SPI; all channels are converted in a single
+  bus transaction (conversion happens while bits are clocked out).
+  Ads1115Source: 4 channels, 16-bit, I2C; the ADC has one converter, so update()
+  is pipelined: it collects the conversion started on previous call and starts the
+  next channel one, that runs while the sketch processes values.
+*/
+
+#ifndef ExtAdcSource_h
+#define ExtAdcSource_h
+
+#include "Arduino.h"
+#include "PressSource.h"
+
+#define MCP3208_CHANNELS 8
+#define MCP3208_FULL_SCALE 4095
+
+#define ADS1115_CHANNELS 4
+#define ADS1115_FULL_SCALE 32767
+#define ADS1115_DEFAULT_ADDR 0x48
+// conversion time at 860 samples per second (us)
+#define ADS1115_CONVERSION_US 1200
+
+class Mcp3208Source : public PressSource
+{
+  public:
+    Mcp3208Source(PressSpiBus *bus, uint8_t channels);
+
+    virtual void update();
+    virtual long value(uint8_t channel);
+    virtual long fullScale();
+
+  private:
+    PressSpiBus *_bus;
+    uint8_t _channels;
+    int _value[MCP3208_CHANNELS];
+};
+
+class Ads1115Source : public PressSource
+{
+  public:
+    Ads1115Source(PressI2cBus *bus, uint8_t addr, uint8_t channels);
+
+    virtual void update();
+    virtual long value(uint8_t channel);
+    virtual long fullScale();
+
+  private:
+    PressI2cBus *_bus;
+    uint8_t _addr;
+    uint8_t _channels;
+    int _value[ADS1115_CHANNELS];
+
+    // channel being converted and when conversion started
+    uint8_t _converting;
+    unsigned long _start_time;
+    bool _started;
+
+    bool _startConversion(uint8_t channel);
+};
+
+#endif // ExtAdcSource_h
@@ -0,0 +1,39 @@
+/*
+  HwSpiBus.h - SPI implementation of PressSource SPI bus
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Header only: include it in the sketch only when an SPI external ADC (e.g. MCP3208)
+  is used, so the SPI library is not linked otherwise.
+*/
+
+#ifndef HwSpiBus_h
+#define HwSpiBus_h
+
+#include "Arduino.h"
+#include <SPI.h>
+#include "PressSource.h"
+
+class HwSpiBus : public PressSpiBus
+{
+  public:
+    HwSpiBus(uint8_t csPin, unsigned long clock) : _settings(clock, MSBFIRST, SPI_MODE0)
+    {
+      _csPin = csPin;
+      pinMode(_csPin, OUTPUT);
+      digitalWrite(_csPin, HIGH);
+      SPI.begin();
+    }
+
+    virtual void beginTransaction() { SPI.beginTransaction(_settings); }
+    virtual void endTransaction() { SPI.endTransaction(); }
+    virtual void select(bool active) { digitalWrite(_csPin, active ? LOW : HIGH); }
+    virtual uint8_t transfer(uint8_t data) { return SPI.transfer(data); }
+
+  private:
+    uint8_t _csPin;
+    SPISettings _settings;
+};
+
+#endif // HwSpiBus_h
@@ -0,0 +1,51 @@
+/*
+  PressSource.h - sources of raw values for "Soft Pressure Sensor"
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  By default SoftPressSensor reads its pin with analogRead() (10-bit, one channel
+  per call). A PressSource instead converts several channels at once (e.g. an
+  external ADC on SPI or I2C): the sketch calls update() once per loop, then each
+  SoftPressSensor::read() takes the last value of its own channel.
+  Buses are abstract so backends can run on a simulated device; Arduino SPI/Wire
+  implementations are in HwSpiBus.h and WireI2cBus.h.
+*/
+
+#ifndef PressSource_h
+#define PressSource_h
+
+#include "Arduino.h"
+
+class PressSource
+{
+  public:
+    // refresh channel values (one bus transaction); call once per loop before read()
+    virtual void update() = 0;
+    // last value converted for a channel
+    virtual long value(uint8_t channel) = 0;
+    // max value returned by value() (1023 for internal ADC)
+    virtual long fullScale() = 0;
+};
+
+// SPI device with its own chip select
+class PressSpiBus
+{
+  public:
+    // begin/end a bus transaction (bus settings), possibly covering several conversions
+    virtual void beginTransaction() = 0;
+    virtual void endTransaction() = 0;
+    // drive device chip select
+    virtual void select(bool active) = 0;
+    virtual uint8_t transfer(uint8_t data) = 0;
+};
+
+// I2C bus with 16-bit registers (MSB first)
+class PressI2cBus
+{
+  public:
+    virtual bool writeRegister(uint8_t addr, uint8_t reg, uint16_t val) = 0;
+    virtual bool readRegister(uint8_t addr, uint8_t reg, uint16_t *val) = 0;
+};
+
+#endif // PressSource_h
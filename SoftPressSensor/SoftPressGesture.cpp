@@ -0,0 +1,108 @@
+/*
+  SoftPressGesture.cpp - library to recognize gestures on a "Soft Pressure Sensor"
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "SoftPressGesture.h"
+
+// states
+#define GESTURE_RELEASED 0
+#define GESTURE_PRESSED  1
+#define GESTURE_HELD     2
+
+#define PRESS_ON_DELTA  (ACTIVE_DELTA + GESTURE_HYSTERESIS)
+#define PRESS_OFF_DELTA (ACTIVE_DELTA - GESTURE_HYSTERESIS)
+
+SoftPressGesture::SoftPressGesture()
+{
+  for (int i = 0; i < GESTURE_EVENTS; i++)
+  {
+    _callback[i] = NULL;
+  }
+  _state = GESTURE_RELEASED;
+  _press_time = 0;
+  _tap_pending = false;
+  _tap_time = 0;
+}
+
+void SoftPressGesture::attach(gesture_event_t ev, gesture_callback_t callback)
+{
+  if (ev < GESTURE_EVENTS)
+  {
+    _callback[ev] = callback;
+  }
+}
+
+void SoftPressGesture::_fire(gesture_event_t ev, int value)
+{
+  if (_callback[ev] != NULL)
+  {
+    _callback[ev](ev, value);
+  }
+}
+
+void SoftPressGesture::update(int press_val, tick_t currTime)
+{
+  if (press_val == (int)NOT_CALIBRATED)
+  {
+    press_val = 0;
+  }
+
+  if (_state == GESTURE_RELEASED)
+  {
+    // first tap confirmed once double tap window is over
+    if ((_tap_pending) && (timeElapsed(currTime, _tap_time) > TIME_MS(GESTURE_DOUBLE_TAP_TIME)))
+    {
+      _tap_pending = false;
+      _fire(GESTURE_TAP, 0);
+    }
+
+    if (press_val > PRESS_ON_DELTA)
+    {//RELEASED->PRESSED
+      _state = GESTURE_PRESSED;
+      _press_time = currTime;
+      _fire(GESTURE_PRESS, press_val);
+    }
+  }
+  else if (press_val < PRESS_OFF_DELTA)
+  {//PRESSED/HELD->RELEASED
+    unsigned long duration = TIME_TO_MS(timeElapsed(currTime, _press_time));
+    bool is_tap = (_state == GESTURE_PRESSED) && (duration < GESTURE_TAP_TIME);
+
+    _state = GESTURE_RELEASED;
+    _fire(GESTURE_RELEASE, (int)min(duration, 0x7FFFUL));
+
+    if (is_tap)
+    {
+      if (_tap_pending)
+      {
+        _tap_pending = false;
+        _fire(GESTURE_DOUBLE_TAP, 0);
+      }
+      else
+      {
+        _tap_pending = true;
+        _tap_time = currTime;
+      }
+    }
+    else if (_tap_pending)
+    {// a long press breaks a tap sequence
+      _tap_pending = false;
+      _fire(GESTURE_TAP, 0);
+    }
+  }
+  else if ((_state == GESTURE_PRESSED) && (timeReached(currTime, _press_time + TIME_MS(GESTURE_HOLD_TIME))))
+  {//PRESSED->HELD
+    _state = GESTURE_HELD;
+    // a hold breaks a tap sequence
+    if (_tap_pending)
+    {
+      _tap_pending = false;
+      _fire(GESTURE_TAP, 0);
+    }
+    _fire(GESTURE_HOLD, press_val);
+  }
+}
@@ -0,0 +1,67 @@
+/*
+  SoftPressGesture.h - library to recognize gestures on a "Soft Pressure Sensor"
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Event driven layer on top of SoftPressSensor: each value returned by read() is
+  fed to an incremental state machine (constant time and memory per sample) that
+  calls the attached callbacks on press, release, tap, double-tap and hold.
+*/
+
+#ifndef SoftPressGesture_h
+#define SoftPressGesture_h
+
+#include "Arduino.h"
+#include "SoftPressSensor.h"
+#include "TimeBase.h"
+
+// hysteresis around ACTIVE_DELTA: pressed above ACTIVE_DELTA + HYSTERESIS,
+// released below ACTIVE_DELTA - HYSTERESIS, so noise on threshold does not bounce
+#define GESTURE_HYSTERESIS      5
+
+// timings (ms)
+#define GESTURE_TAP_TIME        250   // max press duration for a tap
+#define GESTURE_DOUBLE_TAP_TIME 300   // max time between two taps
+#define GESTURE_HOLD_TIME       800   // press duration to fire hold
+
+typedef enum
+{
+  GESTURE_PRESS,
+  GESTURE_RELEASE,
+  GESTURE_TAP,
+  GESTURE_DOUBLE_TAP,
+  GESTURE_HOLD,
+  GESTURE_EVENTS,
+} gesture_event_t;
+
+// callback receives the event and the pressure value (release: press duration in ms)
+typedef void (*gesture_callback_t)(gesture_event_t ev, int value);
+
+class SoftPressGesture
+{
+  public:
+    SoftPressGesture();
+
+    // set callback for an event (NULL to remove it)
+    void attach(gesture_event_t ev, gesture_callback_t callback);
+
+    // feed last value returned by SoftPressSensor::read() (NOT_CALIBRATED is taken as released)
+    // with current time (timeNow())
+    void update(int press_val, tick_t currTime);
+
+  private:
+    gesture_callback_t _callback[GESTURE_EVENTS];
+
+    // recognizer state (released, pressed, held)
+    uint8_t _state;
+    tick_t _press_time;
+
+    // a tap is notified only once no second tap can follow
+    bool _tap_pending;
+    tick_t _tap_time;
+
+    void _fire(gesture_event_t ev, int value);
+};
+
+#endif // SoftPressGesture_h
@@ -11,37 +11,84 @@
 
 #include "Arduino.h"
 #include "SoftPressSensor.h"
+#ifdef LATENCY_PROBES
+#include "LatencyProbe.h"
+#else
+#define LATENCY_PROBE(id)
+#endif // LATENCY_PROBES
 
 #define _DEBUG_SOFT_PRESS_SENSOR
 
 // empiric values; they may adjusted for each "Soft Pressure Sensor"
 // MIN_MAX minimum delta "press sensor" is considered calibrated and starting tracking run-time "min/max"
 #define PEAK_2_PEAK 20
-// minumum analog pressed value to consider the soft button been pressed
-#define ACTIVE_DELTA  20
 // consecutive blocking condition to reset real-time min
 #define BLOCKING_THRESHOLD 4
 // consecutive 'inactive' (i.e. not enough pressure) condition to reset real-time min
 #define INACTIVE_THRESHOLD 10
 
 SoftPressSensor::SoftPressSensor(int pin)
+{
+  pinMode(pin, INPUT_PULLUP);
+  _pin = pin;
+  _source = NULL;
+  _channel = 0;
+  _shift = 0;
+
+  _init();
+}
+
+SoftPressSensor::SoftPressSensor(PressSource *source, uint8_t channel)
+{
+  _pin = -1;
+  _source = source;
+  _channel = channel;
+
+  // scale thresholds (tuned on 10-bit analogRead) to source resolution:
+  // 2 for 12-bit (4095), 5 for 15-bit (32767)
+  _shift = 0;
+  while ((1024L << _shift) <= _source->fullScale())
+  {
+    _shift++;
+  }
+
+  _init();
+}
+
+void SoftPressSensor::_init()
 {
 #ifdef _DEBUG_SOFT_PRESS_SENSOR
   Serial.begin(9600);
 #endif // _DEBUG_SOFT_PRESS_SENSOR
-  pinMode(pin, INPUT_PULLUP);
-  _pin = pin;
+  _active_delta = ACTIVE_DELTA << _shift;
+  _peak_2_peak = PEAK_2_PEAK << _shift;
 
-  _minVal = _absMinVal =2000;
+  _minVal = _absMinVal = 0x7FFFFFFFL;
   _maxVal = _absMaxVal= 0;
 
   _soft_press_ma = 0;
 
   _inactive_cnt=0;
   _is_blocking_cnt = 0;
+  _idle_cnt = 0;
+  _slow_sampling = false;
+  _slow_press = false;
 
   _prev_press_val = 0;
   _press_sensor_calibrated = false;
+
+  for (int i = 0; i < PRESS_HISTORY_SIZE; i++)
+  {
+    _press_hist[i] = 0;
+  }
+  _hist_idx = 0;
+  _slope = 0;
+  _onset_step = 0;
+  _onset_cnt = 0;
+  _pressed = false;
+  _peak = 0;
+  _velocity = 0;
+  _aftertouch = 0;
 }
 
 /*
@@ -54,8 +101,13 @@ SoftPressSensor::SoftPressSensor(int pin)
 
 int SoftPressSensor::read(void)
 {
-  // read RAW value from pressure sensor
-  _soft_press = analogRead(_pin);
+  LATENCY_PROBE(PROBE_SENSOR_READ);
+
+  // read RAW value from pressure sensor (or last one converted by source)
+  if (_source != NULL)
+    _soft_press = _source->value(_channel);
+  else
+    _soft_press = analogRead(_pin);
 
   // start track absolute Max/Min
   _absMaxVal = max(_soft_press, _absMaxVal);
@@ -68,12 +120,24 @@ int SoftPressSensor::read(void)
   // from this point start to track run-time min/max to adjust in real-time the range
   if (_press_sensor_calibrated == false)
   {
-    if (((_soft_press_ma - _absMinVal) > PEAK_2_PEAK/2) &&
-        ((_absMaxVal - _soft_press_ma) > PEAK_2_PEAK/2))
+    if (((_soft_press_ma - _absMinVal) > _peak_2_peak/2) &&
+        ((_absMaxVal - _soft_press_ma) > _peak_2_peak/2))
     {
         _maxVal = max(_soft_press_ma, _maxVal);
         _minVal = min(_soft_press_ma, _minVal);
         _press_sensor_calibrated = true;
+        // calibrated by a press: move to burst sampling
+        _wake();
+    }
+    else if ((_soft_press - _absMinVal) > _peak_2_peak/2)
+    {// raw value already rising: sample the calibration press in burst, as it is averaged
+      _wake();
+    }
+    else
+    {// not calibrated yet means nobody pressed: it counts as idle
+      _slow_press = false;
+      if (_idle_cnt < IDLE_SAMPLES)
+        _idle_cnt++;
     }
     return NOT_CALIBRATED;
   }
@@ -96,15 +160,23 @@ int SoftPressSensor::read(void)
   Serial.println(_maxVal);
   #endif // _DEBUG_SOFT_PRESS_SENSOR
 
+  // velocity and aftertouch: onset tracked on raw value, the moving average is too slow
+  _updateDynamics(max(_soft_press - _minVal, 0L));
+  if (_pressed)
+  {// onset seen on raw value: back to burst sampling before the moving average follows
+    _wake();
+  }
+
   // is it considered an real (active) pressure?
-  if (_press_val > ACTIVE_DELTA)
+  if (_press_val > _active_delta)
   {
     // reset counter to detect not pressure
     _inactive_cnt = 0;
+    _wake();
 
     // check blocking condition indicatig pressure sensor is not coming back to relaxed state
     // (in relaxed state min Val is read)
-    if ((_press_val == _prev_press_val) &&  (_press_val > ACTIVE_DELTA*2))
+    if ((!_slow_press) && (_press_val == _prev_press_val) &&  (_press_val > _active_delta*2))
     {
       _is_blocking_cnt++;
       if (_is_blocking_cnt == BLOCKING_THRESHOLD )
@@ -115,6 +187,11 @@ int SoftPressSensor::read(void)
   }
   else
   {
+    if (!_pressed)
+      _slow_press = false;
+    if (_idle_cnt < IDLE_SAMPLES)
+      _idle_cnt++;
+
     //reset min if not pressure for a while
     _inactive_cnt++;
     if (_inactive_cnt == INACTIVE_THRESHOLD)
@@ -138,7 +215,151 @@ int SoftPressSensor::getRange(void)
     return 0;
 }
 
+// map a pressure value into [0:PRESS_DYNAMICS_MAX] based on passed range
+uint8_t SoftPressSensor::_scaleDynamics(long val, int range)
+{
+  range = max(range, _peak_2_peak);
+  val = val * PRESS_DYNAMICS_MAX / range;
+  return constrain(val, 0, PRESS_DYNAMICS_MAX);
+}
 
+// incrementally update slope, velocity, peak and aftertouch with last raw pressure
+void SoftPressSensor::_updateDynamics(int raw_press)
+{
+  int oldest = _press_hist[_hist_idx];
+  int prev = _press_hist[(_hist_idx - 1) & (PRESS_HISTORY_SIZE - 1)];
+  _press_hist[_hist_idx] = raw_press;
+  _hist_idx = (_hist_idx + 1) & (PRESS_HISTORY_SIZE - 1);
 
+  // average slope on history window, 4 fractional bits
+  _slope = ((long)(raw_press - oldest) * 16) / PRESS_HISTORY_SIZE;
 
+  if ((!_pressed) && (raw_press > _active_delta))
+  {// onset: start measuring strike
+    _pressed = true;
+    _onset_cnt = VELOCITY_SAMPLES;
+    _onset_step = 0;
+    _peak = 0;
+    // previous press velocity is stale: 0 till the new one is latched
+    _velocity = 0;
+  }
 
+  if (!_pressed)
+    return;
+
+  if (_onset_cnt > 0)
+  {
+    // velocity is the steepest step in the first samples, as if kept for the whole window;
+    // raw values swing more than averaged ones, so absolute range is used
+    _onset_step = max(_onset_step, raw_press - prev);
+    if (--_onset_cnt == 0)
+    {
+      _velocity = _scaleDynamics((long)_onset_step * VELOCITY_SAMPLES, _absMaxVal - _absMinVal);
+    }
+  }
+
+  _peak = max(_peak, _press_val);
+  _aftertouch = _scaleDynamics(_press_val, getRange());
+
+  // release: both raw and averaged pressure back under threshold
+  if ((raw_press <= _active_delta) && (_press_val <= _active_delta))
+  {
+    _pressed = false;
+    _onset_cnt = 0;
+    _aftertouch = 0;
+  }
+}
+
+bool SoftPressSensor::isPressed(void)
+{
+  return _pressed;
+}
+
+int SoftPressSensor::getVelocity(void)
+{
+  return _velocity;
+}
+
+int SoftPressSensor::getAftertouch(void)
+{
+  return _aftertouch;
+}
+
+int SoftPressSensor::getPeak(void)
+{
+  return _peak;
+}
+
+int SoftPressSensor::getSlope(void)
+{
+  return _slope;
+}
+
+int SoftPressSensor::getScaleShift(void)
+{
+  return _shift;
+}
+
+bool SoftPressSensor::isIdle(void)
+{
+  return (_idle_cnt >= IDLE_SAMPLES);
+}
+
+unsigned int SoftPressSensor::nextSampleInterval(void)
+{
+  _slow_sampling = isIdle();
+  return _slow_sampling ? IDLE_SAMPLING_TIME : BURST_SAMPLING_TIME;
+}
+
+// back to burst sampling on a press; a press seen after a slow interval is flagged
+void SoftPressSensor::_wake(void)
+{
+  if (_slow_sampling)
+    _slow_press = true;
+  _slow_sampling = false;
+  _idle_cnt = 0;
+}
+
+void SoftPressSensor::saveState(soft_press_state_t *state)
+{
+  state->min_val = _minVal;
+  state->max_val = _maxVal;
+  state->abs_min_val = _absMinVal;
+  state->abs_max_val = _absMaxVal;
+  state->soft_press_ma = _soft_press_ma;
+  state->press_val = _press_val;
+  state->inactive_cnt = _inactive_cnt;
+  state->is_blocking_cnt = _is_blocking_cnt;
+  state->idle_cnt = _idle_cnt;
+  state->peak = _peak;
+  state->velocity = _velocity;
+  state->pressed = _pressed;
+  state->slow_press = _slow_press;
+  state->calibrated = _press_sensor_calibrated;
+}
+
+void SoftPressSensor::restoreState(const soft_press_state_t *state)
+{
+  _minVal = state->min_val;
+  _maxVal = state->max_val;
+  _absMinVal = state->abs_min_val;
+  _absMaxVal = state->abs_max_val;
+  _soft_press_ma = state->soft_press_ma;
+  _press_val = _prev_press_val = state->press_val;
+  _inactive_cnt = state->inactive_cnt;
+  _is_blocking_cnt = state->is_blocking_cnt;
+  _idle_cnt = state->idle_cnt;
+  _peak = state->peak;
+  _velocity = state->velocity;
+  _pressed = state->pressed;
+  _slow_press = state->slow_press;
+  _press_sensor_calibrated = state->calibrated;
+
+  // history is not saved: as if pressure was steady, so no false onset or slope
+  for (int i = 0; i < PRESS_HISTORY_SIZE; i++)
+  {
+    _press_hist[i] = _press_val;
+  }
+  _slope = 0;
+  _onset_cnt = 0;
+}
@@ -13,30 +13,100 @@
 #define SoftPressSensor_h
 
 #include "Arduino.h"
+#include "PressSource.h"
 
 #define NOT_CALIBRATED  0xFFFF
 
+// minumum analog pressed value to consider the soft button been pressed
+#define ACTIVE_DELTA  20
+
+// adaptive sampling: sample slowly once sensor has been inactive for IDLE_SAMPLES samples,
+// at burst rate on activity (ms)
+#define IDLE_SAMPLES        50
+#define IDLE_SAMPLING_TIME  250
+#define BURST_SAMPLING_TIME 10
+
+// raw pressure samples kept to compute slope (power of 2)
+#define PRESS_HISTORY_SIZE 4
+// samples after press onset used to measure strike velocity
+#define VELOCITY_SAMPLES   2
+// velocity and aftertouch range [0:PRESS_DYNAMICS_MAX] (as MIDI)
+#define PRESS_DYNAMICS_MAX 127
+
+// runtime state for warm restart (see WarmRestart): calibration, range, moving average,
+// counters and current press
+typedef struct
+{
+  long min_val;
+  long max_val;
+  long abs_min_val;
+  long abs_max_val;
+  long soft_press_ma;
+  int press_val;
+  int inactive_cnt;
+  int is_blocking_cnt;
+  unsigned int idle_cnt;
+  int peak;
+  uint8_t velocity;
+  bool pressed;
+  bool slow_press;
+  bool calibrated;
+} soft_press_state_t;
+
 class SoftPressSensor
 {
   public:
     SoftPressSensor(int pin);
+    // read values of a channel converted by an external source (e.g. Mcp3208Source)
+    SoftPressSensor(PressSource *source, uint8_t channel);
     int read();
     int getRange();
+
+    // press dynamics, updated by read() with no extra analogRead:
+    // strike velocity latched VELOCITY_SAMPLES after onset (0 before), continuous aftertouch while pressed,
+    // peak pressure since onset and pressure slope (4 fractional bits, per sample)
+    bool isPressed();
+    int getVelocity();
+    int getAftertouch();
+    int getPeak();
+    int getSlope();
+
+    // thresholds are scaled by 2^shift for sources with more than 10 bits
+    // (read() >> getScaleShift() gives back a 10-bit range value, e.g. for SoftPressGesture)
+    int getScaleShift();
+
+    // adaptive sampling: true if nothing pressed for IDLE_SAMPLES samples,
+    // and interval (ms) to wait before next read()
+    bool isIdle();
+    unsigned int nextSampleInterval();
+
+    // warm restart: copy runtime state out, and back after a reset (next read() goes on
+    // with the same calibration instead of NOT_CALIBRATED)
+    void saveState(soft_press_state_t *state);
+    void restoreState(const soft_press_state_t *state);
   private:
 
     //VARIABLES
-    // pressure sensor pin
+    // pressure sensor pin, or source and its channel
     int _pin;
+    PressSource *_source;
+    uint8_t _channel;
+
+    // thresholds scaled to source resolution
+    uint8_t _shift;
+    int _active_delta;
+    int _peak_2_peak;
 
     // pressure value range (max/min) used to calibrate sensor and map value into a range.
-    int _minVal;
-    int _maxVal;
-    int _absMaxVal;
-    int _absMinVal;
+    // long: 16-bit sources overflow int in moving average
+    long _minVal;
+    long _maxVal;
+    long _absMaxVal;
+    long _absMinVal;
 
     //"press sensor" analog value: current and moving averaged one
-    int _soft_press;
-    int _soft_press_ma;
+    long _soft_press;
+    long _soft_press_ma;
 
     // press values: delta between MA soft press value and min value
     int _press_val;
@@ -45,6 +115,28 @@ class SoftPressSensor
     // inactive (no pression detected) and blocking (no change in pression) counters
     int _inactive_cnt;
     int _is_blocking_cnt;
+    // consecutive inactive samples (not reset by min tracking as _inactive_cnt), saturated
+    unsigned int _idle_cnt;
+    // last nextSampleInterval() was IDLE_SAMPLING_TIME, and current press started then:
+    // its ramp was sampled slowly, it is not counted as blocking
+    bool _slow_sampling;
+    bool _slow_press;
+
+    // press dynamics: raw (not averaged) pressure history to detect onset with no delay
+    int _press_hist[PRESS_HISTORY_SIZE];
+    uint8_t _hist_idx;
+    int _slope;
+    int _onset_step;
+    uint8_t _onset_cnt;
+    bool _pressed;
+    int _peak;
+    uint8_t _velocity;
+    uint8_t _aftertouch;
+
+    void _init();
+    void _wake();
+    void _updateDynamics(int raw_press);
+    uint8_t _scaleDynamics(long val, int range);
 
     // flag indicating ensor being calibrated (sensor requires at least a press action to have a valid press range)
     bool _press_sensor_calibrated;
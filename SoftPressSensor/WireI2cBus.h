@@ -0,0 +1,51 @@
+/*
+  WireI2cBus.h - Wire implementation of PressSource I2C bus
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Header only: include it in the sketch only when an I2C external ADC (e.g. ADS1115)
+  is used, so the Wire library is not linked otherwise.
+*/
+
+#ifndef WireI2cBus_h
+#define WireI2cBus_h
+
+#include "Arduino.h"
+#include <Wire.h>
+#include "PressSource.h"
+
+class WireI2cBus : public PressI2cBus
+{
+  public:
+    WireI2cBus(unsigned long clock)
+    {
+      Wire.begin();
+      Wire.setClock(clock);
+    }
+
+    virtual bool writeRegister(uint8_t addr, uint8_t reg, uint16_t val)
+    {
+      Wire.beginTransmission(addr);
+      Wire.write(reg);
+      Wire.write(val >> 8);
+      Wire.write(val & 0xFF);
+      return (Wire.endTransmission() == 0);
+    }
+
+    virtual bool readRegister(uint8_t addr, uint8_t reg, uint16_t *val)
+    {
+      Wire.beginTransmission(addr);
+      Wire.write(reg);
+      if (Wire.endTransmission() != 0)
+        return false;
+      if (Wire.requestFrom(addr, (uint8_t)2) != 2)
+        return false;
+      uint8_t hi = Wire.read();
+      uint8_t lo = Wire.read();
+      *val = ((uint16_t)hi << 8) | lo;
+      return true;
+    }
+};
+
+#endif // WireI2cBus_h
@@ -0,0 +1,276 @@
+/*
+  sim_ext_adc.cpp - host check of external ADC backends on simulated bus devices
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Build and run on PC (not part of the Arduino library):
+    g++ -O2 -I../../extras/host -I.. sim_ext_adc.cpp ../ExtAdcSource.cpp ../SoftPressSensor.cpp \
+        ../../extras/host/Arduino.cpp -o sim_ext_adc
+    ./sim_ext_adc
+
+  An MCP3208 answers the SPI transfers of Mcp3208Source bit by bit as the datasheet
+  frames them, an ADS1115 answers I2C register accesses of Ads1115Source, converting
+  in ADS1115_CONVERSION_US on the virtual clock. Checked:
+    - values of every channel, one bus transaction per update() for the MCP3208,
+      no read of the ADS1115 before its conversion is over
+    - scale shift (10-bit thresholds to source resolution)
+    - a SoftPressSensor on each source follows the same press script of one on
+      analogRead(), with values scaled to the source resolution: same presses (a light
+      tap too) and read() >> getScaleShift() within 5% of the 10-bit value
+*/
+
+#include <stdio.h>
+
+#include "Arduino.h"
+#include "SoftPressSensor.h"
+#include "ExtAdcSource.h"
+
+#define SENSOR_PIN 0
+#define LOOP_MS    10
+#define RUN_MS     8000UL
+
+#define IDLE_VALUE 300
+// 10-bit tap just over 1.5x ACTIVE_DELTA (lost if thresholds are scaled too much), hard hold
+#define TAP_DELTA  32
+#define HOLD_DELTA 150
+
+static int failures;
+
+static void check(bool ok, const char *what)
+{
+  printf("%-60s %s\n", what, ok ? "ok" : "FAIL");
+  if (!ok)
+    failures++;
+}
+
+// 10-bit pad value of the script: light tap, then hard hold
+static int pad_value(unsigned long ms)
+{
+  if ((ms >= 2000) && (ms < 2300))
+    return IDLE_VALUE + TAP_DELTA;
+  if ((ms >= 4000) && (ms < 6500))
+    return IDLE_VALUE + HOLD_DELTA;
+  return IDLE_VALUE;
+}
+
+// MCP3208 on SPI: command clocked in, result clocked out in the same 3 bytes
+class SimMcp3208 : public PressSpiBus
+{
+  public:
+    long input[MCP3208_CHANNELS];
+    int transactions;
+    int transactions_open;
+
+    SimMcp3208() : transactions(0), transactions_open(0), _selected(false), _byte(0), _channel(0) {}
+
+    virtual void beginTransaction() { transactions++; transactions_open++; }
+    virtual void endTransaction() { transactions_open--; }
+    virtual void select(bool active)
+    {
+      _selected = active;
+      _byte = 0;
+    }
+    virtual uint8_t transfer(uint8_t data)
+    {
+      if ((!_selected) || (transactions_open != 1))
+        return 0xFF;
+
+      uint8_t out = 0;
+      if (_byte == 0)
+      {
+        // 00000 start single/diff D2
+        _channel = ((data & 0x04) && (data & 0x02)) ? ((data & 0x01) << 2) : 0xFF;
+      }
+      else if (_byte == 1)
+      {
+        // D1 D0 in bits 7:6; answer: sampling, null bit, B11..B8
+        if (_channel != 0xFF)
+          _channel |= data >> 6;
+        out = (_channel != 0xFF) ? (_sample() >> 8) & 0x0F : 0xFF;
+      }
+      else if (_byte == 2)
+      {
+        out = (_channel != 0xFF) ? _sample() & 0xFF : 0xFF;
+      }
+      _byte++;
+      return out;
+    }
+
+  private:
+    bool _selected;
+    uint8_t _byte;
+    uint8_t _channel;
+
+    int _sample() { return constrain(input[_channel], 0L, (long)MCP3208_FULL_SCALE); }
+};
+
+// ADS1115 on I2C: single shot conversion started by config register write
+class SimAds1115 : public PressI2cBus
+{
+  public:
+    long input[ADS1115_CHANNELS];
+    int early_reads;
+
+    SimAds1115() : early_reads(0), _result(0), _start(0), _busy(false), _channel(0) {}
+
+    virtual bool writeRegister(uint8_t addr, uint8_t reg, uint16_t val)
+    {
+      if ((addr != ADS1115_DEFAULT_ADDR) || (reg != 0x01))
+        return false;
+      if (val & 0x8000)
+      {
+        // MUX 1xx: AINx vs GND
+        _channel = (val >> 12) & 0x03;
+        _start = micros();
+        _busy = true;
+      }
+      return true;
+    }
+
+    virtual bool readRegister(uint8_t addr, uint8_t reg, uint16_t *val)
+    {
+      if ((addr != ADS1115_DEFAULT_ADDR) || (reg != 0x00))
+        return false;
+      if ((_busy) && (micros() - _start < ADS1115_CONVERSION_US))
+      {
+        early_reads++;
+      }
+      else if (_busy)
+      {
+        _result = constrain(input[_channel], 0L, (long)ADS1115_FULL_SCALE);
+        _busy = false;
+      }
+      *val = (uint16_t)_result;
+      return true;
+    }
+
+  private:
+    int16_t _result;
+    unsigned long _start;
+    bool _busy;
+    uint8_t _channel;
+};
+
+static int pin_value;
+
+static int on_analog_read(uint8_t)
+{
+  return pin_value;
+}
+
+static void check_channels(SimMcp3208 *mcp, SimAds1115 *ads)
+{
+  Mcp3208Source mcp_src(mcp, MCP3208_CHANNELS);
+  Ads1115Source ads_src(ads, ADS1115_DEFAULT_ADDR, ADS1115_CHANNELS);
+
+  for (int ch = 0; ch < MCP3208_CHANNELS; ch++)
+    mcp->input[ch] = 17 + ch * 581;
+  for (int ch = 0; ch < ADS1115_CHANNELS; ch++)
+    ads->input[ch] = 1000 + ch * 10000;
+
+  mcp->transactions = 0;
+  mcp_src.update();
+  bool ok = (mcp->transactions == 1);
+  for (int ch = 0; ch < MCP3208_CHANNELS; ch++)
+    ok = ok && (mcp_src.value(ch) == mcp->input[ch]);
+  check(ok, "MCP3208: 8 channels in one transaction");
+
+  // pipelined: one channel per completed conversion, update() called every 100us
+  for (int i = 0; i < 200; i++)
+  {
+    ads_src.update();
+    host_advance_micros(100);
+  }
+  ok = (ads->early_reads == 0);
+  for (int ch = 0; ch < ADS1115_CHANNELS; ch++)
+    ok = ok && (ads_src.value(ch) == ads->input[ch]);
+  check(ok, "ADS1115: 4 channels, no read before conversion is over");
+
+  SoftPressSensor mcp_sensor(&mcp_src, 0);
+  SoftPressSensor ads_sensor(&ads_src, 0);
+  check(mcp_sensor.getScaleShift() == 2, "MCP3208: scale shift 2 (12-bit)");
+  check(ads_sensor.getScaleShift() == 5, "ADS1115: scale shift 5 (15-bit)");
+}
+
+// press script statistics of a sensor
+typedef struct
+{
+  int presses;
+  int pressed_samples;
+  int max_value;     // read() >> getScaleShift()
+  bool was_pressed;
+} press_stats_t;
+
+static void track(SoftPressSensor *sensor, int value, press_stats_t *st)
+{
+  bool pressed = sensor->isPressed();
+  if ((pressed) && (!st->was_pressed))
+    st->presses++;
+  if (pressed)
+    st->pressed_samples++;
+  st->was_pressed = pressed;
+  if (value != (int)NOT_CALIBRATED)
+    st->max_value = max(st->max_value, value >> sensor->getScaleShift());
+}
+
+// same presses and value of sensor on analogRead(): moving averages truncate at
+// different resolutions, so values are within a few steps (and min resets, that release
+// a press, may happen some samples apart)
+static bool same_press(const press_stats_t *st, const press_stats_t *ref)
+{
+  return (st->presses == ref->presses) && (abs(st->max_value - ref->max_value) <= ref->max_value / 20);
+}
+
+static void check_press(SimMcp3208 *mcp, SimAds1115 *ads)
+{
+  Mcp3208Source mcp_src(mcp, 1);
+  Ads1115Source ads_src(ads, ADS1115_DEFAULT_ADDR, 1);
+
+  SoftPressSensor pin_sensor(SENSOR_PIN);
+  SoftPressSensor mcp_sensor(&mcp_src, 0);
+  SoftPressSensor ads_sensor(&ads_src, 0);
+
+  press_stats_t pin_st = { 0, 0, 0, false }, mcp_st = pin_st, ads_st = pin_st;
+  host_set_micros(0);
+
+  for (unsigned long ms = 0; ms < RUN_MS; ms += LOOP_MS)
+  {
+    int v = pad_value(ms) + (int)((ms / LOOP_MS) % 3) - 1;
+    pin_value = v;
+    // same voltage on a 12-bit and a 15-bit converter
+    mcp->input[0] = (long)v << 2;
+    ads->input[0] = (long)v << 5;
+
+    mcp_src.update();
+    ads_src.update();
+    host_advance_micros(ADS1115_CONVERSION_US);
+    ads_src.update();
+
+    track(&pin_sensor, pin_sensor.read(), &pin_st);
+    track(&mcp_sensor, mcp_sensor.read(), &mcp_st);
+    track(&ads_sensor, ads_sensor.read(), &ads_st);
+
+    host_advance_micros(LOOP_MS * 1000UL - ADS1115_CONVERSION_US);
+  }
+
+  printf("press script     presses  pressed samples  max value (10-bit)\n");
+  printf("analogRead()     %4d     %6d           %4d\n", pin_st.presses, pin_st.pressed_samples, pin_st.max_value);
+  printf("MCP3208          %4d     %6d           %4d\n", mcp_st.presses, mcp_st.pressed_samples, mcp_st.max_value);
+  printf("ADS1115          %4d     %6d           %4d\n", ads_st.presses, ads_st.pressed_samples, ads_st.max_value);
+  check(pin_st.presses == 2, "analogRead(): both presses of the script");
+  check(same_press(&mcp_st, &pin_st), "MCP3208: presses and values as with analogRead()");
+  check(same_press(&ads_st, &pin_st), "ADS1115: presses and values as with analogRead()");
+}
+
+int main()
+{
+  host_on_analog_read(on_analog_read);
+
+  SimMcp3208 mcp;
+  SimAds1115 ads;
+  check_channels(&mcp, &ads);
+  check_press(&mcp, &ads);
+
+  return (failures == 0) ? 0 : 1;
+}
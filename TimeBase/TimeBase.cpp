@@ -0,0 +1,42 @@
+/*
+  TimeBase.cpp - library to share a wrap-safe time base among libraries
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "TimeBase.h"
+
+static time_source_t time_source = NULL;
+
+void timeSetSource(time_source_t source)
+{
+  time_source = source;
+}
+
+tick_t timeNow()
+{
+  if (time_source != NULL)
+    return time_source();
+#ifdef TIMEBASE_MICROS
+  return micros();
+#else
+  return millis();
+#endif // TIMEBASE_MICROS
+}
+
+void timeSleepUntil(tick_t deadline)
+{
+  tick_t now = timeNow();
+  if (timeReached(now, deadline))
+    return;
+
+  tick_t wait = deadline - now;
+#ifdef TIMEBASE_MICROS
+  delay(wait / 1000);
+  delayMicroseconds(wait % 1000);
+#else
+  delay(wait);
+#endif // TIMEBASE_MICROS
+}
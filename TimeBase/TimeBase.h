@@ -0,0 +1,89 @@
+/*
+  TimeBase.h - library to share a wrap-safe time base among libraries
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Libraries take times (currTime, deadlines) as tick_t: a 32-bit counter that wraps
+  around (after 49.7 days in ms), so times are compared only through the helpers
+  below, right as long as compared times are less than half the range apart
+  (24.8 days in ms, 35 minutes in us). Durations stay in ms in the APIs and are
+  turned into ticks with TIME_MS().
+
+  Resolution is 1ms, or 1us when TIMEBASE_MICROS is defined (uncomment the define below
+  or pass -DTIMEBASE_MICROS in build flags: all libraries have to see the same setting),
+  for sub-millisecond fades.
+
+  Time comes from millis() (micros()) or from the function passed to timeSetSource(),
+  e.g. a simulation on PC jumping the clock to test rollover, or an external clock.
+*/
+
+#ifndef TIMEBASE_H_INCLUDED
+#define TIMEBASE_H_INCLUDED
+
+#ifdef ARDUINO
+#include "Arduino.h"
+#else
+// host build (no Arduino core, e.g. ScoreSequencer extras): only types and inline helpers
+#include <stdint.h>
+#endif // ARDUINO
+
+//#define TIMEBASE_MICROS
+
+typedef uint32_t tick_t;
+
+#ifdef TIMEBASE_MICROS
+#define TIME_TICKS_PER_MS 1000UL
+#else
+#define TIME_TICKS_PER_MS 1UL
+#endif // TIMEBASE_MICROS
+
+// ms to ticks and back
+#define TIME_MS(ms)    ((tick_t)((ms) * TIME_TICKS_PER_MS))
+#define TIME_TO_MS(t)  ((t) / TIME_TICKS_PER_MS)
+
+typedef tick_t (*time_source_t)(void);
+
+// inject time source (NULL: millis() or micros())
+void timeSetSource(time_source_t source);
+tick_t timeNow();
+// wait till deadline (with delay(): an injected source has to follow the real clock)
+void timeSleepUntil(tick_t deadline);
+
+// true if deadline is now or in the past
+inline bool timeReached(tick_t now, tick_t deadline)
+{
+  return (int32_t)(now - deadline) >= 0;
+}
+
+// true if a comes before b
+inline bool timeBefore(tick_t a, tick_t b)
+{
+  return (int32_t)(a - b) < 0;
+}
+
+inline tick_t timeEarliest(tick_t a, tick_t b)
+{
+  return timeBefore(a, b) ? a : b;
+}
+
+// ticks from a past time to now
+inline tick_t timeElapsed(tick_t now, tick_t since)
+{
+  return now - since;
+}
+
+// value*elapsed/duration in 8.8 fixed point (value up to 255, elapsed up to duration),
+// e.g. a fade level; long durations in us ticks lose low bits to keep products in 32 bits
+inline unsigned long timeScale16(unsigned long value, tick_t elapsed, tick_t duration)
+{
+  while (duration > 0xFFFFFFUL)
+  {
+    duration >>= 1;
+    elapsed >>= 1;
+  }
+  unsigned long q = value * elapsed;
+  return ((q / duration) << 8) + ((q % duration) << 8) / duration;
+}
+
+#endif // TIMEBASE_H_INCLUDED
@@ -0,0 +1,214 @@
+/*
+  sim_rollover.cpp - host check of scheduling across the 32-bit clock rollover
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Build and run on PC (not part of the Arduino library), with ms ticks and then
+  with us ticks (add -DTIMEBASE_MICROS):
+    g++ -O2 -I../../extras/host -I.. -I../../SoftPressSensor -I../../FadingPatternLed \
+        -I../../IdleScheduler -I../../NewtonColorCirclePlay -I../../music \
+        sim_rollover.cpp ../TimeBase.cpp ../../SoftPressSensor/SoftPressGesture.cpp \
+        ../../FadingPatternLed/FadingPatternLed.cpp ../../IdleScheduler/IdleScheduler.cpp \
+        ../../NewtonColorCirclePlay/NewtonColorCirclePlay.cpp \
+        ../../extras/host/Arduino.cpp -o sim_rollover
+    ./sim_rollover
+
+  A sketch with one FadingPatternLed (excited from 10s to 20s), a SoftPressGesture fed
+  with a scripted double tap and hold, and an IdleScheduler sleeping between deadlines
+  runs RUN_MS on the virtual clock three times:
+    - reference: clock starting at 0
+    - clock rollover: millis() (micros()) starting PRE_WRAP_MS before its rollover
+    - injected source: timeSetSource() clock jumped PRE_WRAP_MS before rollover
+  Pwm writes, gestures and wake-ups are traced with their time from start: the three
+  traces have to be the same.
+  Then a 40ms fade cycle is refreshed every REFRESH_US: ms ticks give a new PWM level
+  at most every ms, us ticks every step of the 255 levels.
+  Last, a NewtonColorCirclePlay note flash rendered again a whole tick range after it
+  started has to stay off.
+*/
+
+#include <stdio.h>
+
+#include "Arduino.h"
+#include "TimeBase.h"
+#include "SoftPressGesture.h"
+#include "FadingPatternLed.h"
+#include "IdleScheduler.h"
+#include "NewtonColorCirclePlay.h"
+#include "pitches.h"
+
+#define LED_PIN 9
+
+#define RUN_MS      60000UL
+#define PRE_WRAP_MS 30000UL
+#define GESTURE_MS  10
+#define LOOP_OVERHEAD_US 30
+
+#define PRESS_VALUE 200
+
+#define REFRESH_US 100
+
+static tick_t start_time;
+static tick_t source_offset;
+
+static unsigned long trace;
+static unsigned long writes;
+static unsigned long gestures;
+
+static void trace_event(unsigned long ev)
+{
+  trace = trace * 31 + ev;
+  trace = trace * 31 + timeElapsed(timeNow(), start_time);
+}
+
+static void on_analog_write(uint8_t pin, int val)
+{
+  writes++;
+  trace_event(((unsigned long)pin << 8) | val);
+}
+
+static void on_gesture(gesture_event_t ev, int)
+{
+  gestures++;
+  trace_event(0x10000UL + ev);
+}
+
+static tick_t injected_source()
+{
+#ifdef TIMEBASE_MICROS
+  return source_offset + micros();
+#else
+  return source_offset + millis();
+#endif // TIMEBASE_MICROS
+}
+
+// scripted pad: double tap at 30s, hold at 40s
+static int pad_value(unsigned long ms)
+{
+  if (((ms >= 30000) && (ms < 30100)) || ((ms >= 30200) && (ms < 30300)) ||
+      ((ms >= 40000) && (ms < 41500)))
+    return PRESS_VALUE;
+  return 0;
+}
+
+static void run(const char *name, tick_t wrap_clock, tick_t wrap_source)
+{
+  // tick_t before rollover, in host us
+  host_set_micros((unsigned long)wrap_clock * (1000 / TIME_TICKS_PER_MS));
+  source_offset = wrap_source;
+  timeSetSource((wrap_source != 0) ? injected_source : NULL);
+
+  trace = writes = gestures = 0;
+  start_time = timeNow();
+
+  FadingPatternLed led(LED_PIN, 1500, 500, 1500, 3000, 200);
+  SoftPressGesture gesture;
+  IdleScheduler sched;
+  for (int ev = 0; ev < GESTURE_EVENTS; ev++)
+  {
+    gesture.attach((gesture_event_t)ev, on_gesture);
+  }
+
+  tick_t next_pattern = start_time;
+  tick_t next_gesture = start_time;
+
+  while (true)
+  {
+    tick_t now = timeNow();
+    unsigned long ms = TIME_TO_MS(timeElapsed(now, start_time));
+    if (ms >= RUN_MS)
+      break;
+
+    sched.begin(now);
+    led.exciting = ((ms >= 10000) && (ms < 20000));
+    if (timeReached(now, next_pattern))
+    {
+      led.updatePattern();
+      next_pattern += TIME_MS(SAMPLING_TIME);
+    }
+    if (timeReached(now, next_gesture))
+    {
+      gesture.update(pad_value(ms), now);
+      next_gesture += TIME_MS(GESTURE_MS);
+    }
+    led.UpdateDisplay(now);
+
+    sched.request(next_pattern);
+    sched.request(next_gesture);
+    sched.request(led.nextDeadline(now));
+    host_advance_micros(LOOP_OVERHEAD_US);
+    sched.sleep();
+  }
+
+  printf("%-16s start 0x%08lx: %6lu pwm writes, %lu gestures, %6lu wake-ups, trace %08lx\n",
+         name, (unsigned long)start_time, writes, gestures, sched.wakeups(), trace & 0xFFFFFFFFUL);
+}
+
+static bool levels[256];
+
+static void on_level_write(uint8_t, int val)
+{
+  levels[val & 0xFF] = true;
+}
+
+static void fade_levels()
+{
+  host_set_micros(0);
+  timeSetSource(NULL);
+  host_on_analog_write(on_level_write);
+
+  // 40ms fades from off to full brightness: 255 PWM steps each
+  FadingPatternLed led(LED_PIN, 40, 10, 40, 10, 0);
+  for (unsigned long t = 0; t < 100000UL; t += REFRESH_US)
+  {
+    led.UpdateDisplay(timeNow());
+    host_advance_micros(REFRESH_US);
+  }
+
+  int n = 0;
+  for (int i = 0; i < 256; i++)
+  {
+    n += levels[i];
+  }
+  printf("40ms fades refreshed every %dus with %s ticks: %d PWM levels\n",
+         REFRESH_US, (TIME_TICKS_PER_MS == 1) ? "ms" : "us", n);
+}
+
+static bool flash_wrap()
+{
+  uint8_t rgb[3];
+  NewtonColorCirclePlay color(3, 5, 6, 20, COMMON_ANODE);
+  color.setOutput(rgb);
+
+  tick_t start = timeNow();
+  color.Flash(NOTE_C4, 250, start);
+  color.Render(start + TIME_MS(100));
+  bool lit = (rgb[0] | rgb[1] | rgb[2]) != 0;
+  color.Render(start + TIME_MS(300));
+  // 2^32 ticks and 100ms after start: same 32-bit tick as 100ms after start
+  color.Render(start + TIME_MS(100));
+  bool off = (rgb[0] | rgb[1] | rgb[2]) == 0;
+
+  printf("note flash after a tick range: %s\n", (lit && off) ? "off" : "LIT AGAIN");
+  return lit && off;
+}
+
+int main()
+{
+  const tick_t pre_wrap = (tick_t)0 - TIME_MS(PRE_WRAP_MS);
+
+  host_on_analog_write(on_analog_write);
+
+  run("reference", 0, 0);
+  unsigned long ref = trace;
+  run("clock rollover", pre_wrap, 0);
+  bool same = (trace == ref);
+  run("injected source", 0, pre_wrap);
+  same = same && (trace == ref);
+  printf("traces across rollover: %s\n", same ? "same" : "DIFFERENT");
+
+  fade_levels();
+  bool flash_ok = flash_wrap();
+  return (same && flash_ok) ? 0 : 1;
+}
@@ -0,0 +1,330 @@
+/*
+  VelostatMatrix.cpp - library to scan a multi-touch Velostat pressure matrix
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "VelostatMatrix.h"
+
+// same empiric values of SoftPressSensor (ACTIVE_DELTA and INACTIVE_THRESHOLD)
+#define MATRIX_ACTIVE_DELTA 20
+#define MATRIX_INACTIVE_THRESHOLD 10
+
+// time (us) spent by digitalWrite(), used to estimate frame duration
+#define MATRIX_IO_TIME_US 4
+
+// baseline not initialized yet (first scan)
+#define MATRIX_NO_BASELINE -1
+
+VelostatMatrix::VelostatMatrix(const uint8_t *rowPins, uint8_t rows, const uint8_t *muxPins, uint8_t muxBits,
+                               uint8_t analogPin, uint8_t cols, matrix_cell_t *cells, uint8_t *frame,
+                               unsigned int size)
+{
+  _rowPins = rowPins;
+  _muxPins = muxPins;
+  _muxBits = min(muxBits, MATRIX_MAX_MUX_BITS);
+  _analogPin = analogPin;
+
+  // fit grid into mux and cell buffers
+  _cols = constrain(cols, 1, 1 << _muxBits);
+  _rows = constrain(rows, 1, MATRIX_MAX_ROWS);
+  _rows = min((unsigned int)_rows, size / _cols);
+  _cells = cells;
+  _frame = frame;
+
+  for (int r = 0; r < _rows; r++)
+  {
+    pinMode(_rowPins[r], OUTPUT);
+    digitalWrite(_rowPins[r], LOW);
+  }
+  for (int b = 0; b < _muxBits; b++)
+  {
+    pinMode(_muxPins[b], OUTPUT);
+    digitalWrite(_muxPins[b], LOW);
+  }
+  pinMode(_analogPin, INPUT);
+
+  for (int i = 0; i < _rows * _cols; i++)
+  {
+    _cells[i].ma = MATRIX_NO_BASELINE;
+    _cells[i].min_val = 0;
+    _cells[i].inactive_cnt = 0;
+    _cells[i].raw = 0;
+    _frame[i] = 0;
+  }
+
+  _row_settle = MATRIX_ROW_SETTLE_US;
+  _col_settle = MATRIX_COL_SETTLE_US;
+  _ghost = 128;
+  _frame_time = 0;
+}
+
+void VelostatMatrix::setSettleTime(unsigned int row_us, unsigned int col_us)
+{
+  _row_settle = row_us;
+  _col_settle = col_us;
+}
+
+bool VelostatMatrix::setFrameBudget(unsigned long budget_us)
+{
+  // fixed cost: row settle and row on/off, then for each cell a conversion and (gray code) one mux line
+  unsigned long cells = (unsigned long)_rows * _cols;
+  unsigned long fixed = _rows * (_row_settle + 2 * MATRIX_IO_TIME_US) +
+                        cells * (MATRIX_ADC_TIME_US + MATRIX_IO_TIME_US);
+
+  if (fixed > budget_us)
+  {
+    _col_settle = 0;
+    return false;
+  }
+  _col_settle = min((budget_us - fixed) / cells, 0xFFFFUL);
+  return true;
+}
+
+void VelostatMatrix::setGhostCompensation(uint8_t strength)
+{
+  _ghost = strength;
+}
+
+unsigned long VelostatMatrix::frameTime()
+{
+  return _frame_time;
+}
+
+uint8_t VelostatMatrix::rows()
+{
+  return _rows;
+}
+
+uint8_t VelostatMatrix::cols()
+{
+  return _cols;
+}
+
+uint8_t VelostatMatrix::get(uint8_t row, uint8_t col)
+{
+  if ((row >= _rows) || (col >= _cols))
+    return 0;
+  return _frame[row * _cols + col];
+}
+
+const uint8_t *VelostatMatrix::frame()
+{
+  return _frame;
+}
+
+// drive only mux select lines that changed from previous column
+void VelostatMatrix::_selectColumn(uint8_t col, uint8_t prev)
+{
+  uint8_t changed = col ^ prev;
+  for (int b = 0; b < _muxBits; b++)
+  {
+    if (changed & (1 << b))
+    {
+      digitalWrite(_muxPins[b], (col >> b) & 1);
+    }
+  }
+}
+
+// baseline tracking of SoftPressSensor::read(): moving average, min reset after inactivity
+void VelostatMatrix::_trackCell(uint8_t cell, int raw)
+{
+  matrix_cell_t *c = &_cells[cell];
+  if (c->ma == MATRIX_NO_BASELINE)
+  {// first sample: start from it instead of ramping up from 0
+    c->ma = raw;
+    c->min_val = raw;
+  }
+
+  c->ma = (c->ma * 7 + raw) / 8;
+  c->min_val = min(c->min_val, c->ma);
+
+  int press = c->ma - c->min_val;
+  if (press > MATRIX_ACTIVE_DELTA)
+  {
+    c->inactive_cnt = 0;
+  }
+  else if (++c->inactive_cnt == MATRIX_INACTIVE_THRESHOLD)
+  {
+    c->inactive_cnt = 0;
+    c->min_val = c->ma;
+  }
+
+  c->raw = min(press, 255);
+  _frame[cell] = c->raw;
+}
+
+void VelostatMatrix::scan()
+{
+  unsigned long start = micros();
+  uint8_t steps = 1 << _muxBits;
+  uint8_t prev = 0;
+
+  // force all mux lines at first column
+  for (int b = 0; b < _muxBits; b++)
+  {
+    digitalWrite(_muxPins[b], LOW);
+  }
+
+  for (int r = 0; r < _rows; r++)
+  {
+    digitalWrite(_rowPins[r], HIGH);
+    delayMicroseconds(_row_settle);
+
+    // columns in gray code order (one mux line changes per step), reversed on odd rows
+    // so that next row starts where previous ended
+    for (int i = 0; i < steps; i++)
+    {
+      uint8_t g = (r & 1) ? (steps - 1 - i) : i;
+      uint8_t col = g ^ (g >> 1);
+      if (col >= _cols)
+        continue;
+
+      _selectColumn(col, prev);
+      prev = col;
+      if (_col_settle > 0)
+        delayMicroseconds(_col_settle);
+
+      _trackCell(r * _cols + col, analogRead(_analogPin));
+    }
+
+    digitalWrite(_rowPins[r], LOW);
+  }
+
+  if (_ghost > 0)
+    _compensateGhosts();
+
+  _frame_time = micros() - start;
+}
+
+/* a pressed cell at (r,c) may read some pressure when cells (r,c'), (r',c') and (r',c)
+   are pressed: current flows through them back into column c. The ghost is estimated as
+   the strongest of such paths, each as strong as its weakest cell, counting only paths
+   where (r,c) is the weakest corner of the rectangle: a ghost reads less than the cells
+   it comes through, so the true presses of an L (or of a rectangle) are not changed.
+   Paths through both 4-neighbours of (r,c) are not counted: the 2x2 rectangle is under
+   the same finger, so (r,c) is part of the press and its pressure is kept.
+*/
+void VelostatMatrix::_compensateGhosts()
+{
+  // estimates are computed on values read (raw), not on already compensated ones
+  for (int r = 0; r < _rows; r++)
+  {
+    for (int c = 0; c < _cols; c++)
+    {
+      uint8_t v = _cells[r * _cols + c].raw;
+      if (v == 0)
+        continue;
+
+      uint8_t ghost = 0;
+      for (int r2 = 0; r2 < _rows; r2++)
+      {
+        uint8_t in_col = _cells[r2 * _cols + c].raw;
+        // path can not be stronger than its cell in this column
+        if ((r2 == r) || (in_col <= ghost) || (in_col < v))
+          continue;
+
+        for (int c2 = 0; c2 < _cols; c2++)
+        {
+          if ((c2 == c) || ((abs(r2 - r) == 1) && (abs(c2 - c) == 1)))
+            continue;
+          uint8_t path = min(in_col, min(_cells[r * _cols + c2].raw, _cells[r2 * _cols + c2].raw));
+          if ((path > ghost) && (v <= path))
+            ghost = path;
+        }
+      }
+
+      _frame[r * _cols + c] = max((int)v - (((int)ghost * _ghost) >> 8), 0);
+    }
+  }
+}
+
+bool VelostatMatrix::centroid(uint8_t *x16, uint8_t *y16)
+{
+  unsigned long sum = 0, sx = 0, sy = 0;
+
+  for (int r = 0; r < _rows; r++)
+  {
+    for (int c = 0; c < _cols; c++)
+    {
+      uint8_t v = _frame[r * _cols + c];
+      sum += v;
+      sx += (unsigned long)v * c;
+      sy += (unsigned long)v * r;
+    }
+  }
+  if (sum == 0)
+    return false;
+
+  *x16 = (sx << 4) / sum;
+  *y16 = (sy << 4) / sum;
+  return true;
+}
+
+uint8_t VelostatMatrix::blobs(matrix_blob_t *blob, uint8_t max_blobs)
+{
+  uint8_t found = 0;
+  int cells = _rows * _cols;
+
+  for (int i = 0; i < cells; i++)
+  {
+    _cells[i].visited = false;
+  }
+
+  for (int start = 0; (start < cells) && (found < max_blobs); start++)
+  {
+    if ((_frame[start] < MATRIX_BLOB_THRESHOLD) || (_cells[start].visited))
+      continue;
+
+    // flood fill from start cell: stack linked through cells (each cell pushed once)
+    matrix_blob_t *b = &blob[found++];
+    unsigned long sx = 0, sy = 0;
+    uint8_t top = start;
+    int depth = 1;
+    b->cells = 0;
+    b->peak = 0;
+    b->sum = 0;
+
+    _cells[start].visited = true;
+
+    while (depth > 0)
+    {
+      uint8_t cell = top;
+      top = _cells[cell].next;
+      depth--;
+
+      uint8_t r = cell / _cols;
+      uint8_t c = cell % _cols;
+      uint8_t v = _frame[cell];
+
+      b->cells++;
+      b->peak = max(b->peak, v);
+      b->sum += v;
+      sx += (unsigned long)v * c;
+      sy += (unsigned long)v * r;
+
+      // 4-connected neighbours: up, down, left, right
+      int next[4] = { (r > 0) ? cell - _cols : -1,
+                      (r < _rows - 1) ? cell + _cols : -1,
+                      (c > 0) ? cell - 1 : -1,
+                      (c < _cols - 1) ? cell + 1 : -1 };
+      for (int n = 0; n < 4; n++)
+      {
+        int i = next[n];
+        if ((i >= 0) && (_frame[i] >= MATRIX_BLOB_THRESHOLD) && (!_cells[i].visited))
+        {
+          _cells[i].visited = true;
+          _cells[i].next = top;
+          top = i;
+          depth++;
+        }
+      }
+    }
+
+    b->x16 = (sx << 4) / b->sum;
+    b->y16 = (sy << 4) / b->sum;
+  }
+  return found;
+}
@@ -0,0 +1,112 @@
+/*
+  VelostatMatrix.h - library to scan a multi-touch Velostat pressure matrix
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  A Velostat sheet between row and column conductive stripes makes a grid of soft
+  pressure cells. Rows are driven by digital pins, columns are read by one analog
+  pin through a multiplexer (e.g. CD74HC4067), so a 8x8 pad needs 8+3+1 pins.
+  Each cell keeps its own baseline with the same tracking of SoftPressSensor::read()
+  (moving average, run-time min reset after inactivity); ghost readings, due to
+  current flowing back through other pressed cells, are compensated.
+  Output is a frame of 8-bit pressure values, with optional centroid and blobs.
+  Cell state and frame are buffers of the sketch, sized for its grid, e.g.
+    matrix_cell_t cells[8 * 8];
+    uint8_t frame[8 * 8];
+    VelostatMatrix pad(rowPins, 8, muxPins, 3, A0, 8, cells, frame, 8 * 8);
+*/
+
+#ifndef VelostatMatrix_h
+#define VelostatMatrix_h
+
+#include "Arduino.h"
+
+#define MATRIX_MAX_ROWS 16
+#define MATRIX_MAX_MUX_BITS 4
+
+// time (us) spent by analogRead() with default ADC prescaler
+#define MATRIX_ADC_TIME_US 112
+
+// default settle time (us) after driving a new row and after switching mux column
+#define MATRIX_ROW_SETTLE_US 50
+#define MATRIX_COL_SETTLE_US 5
+
+// minimum pressure for a cell to belong to a blob
+#define MATRIX_BLOB_THRESHOLD 20
+
+// per cell state (8 bytes): baseline tracking as SoftPressSensor, pressure read before
+// ghost compensation, blob search
+typedef struct
+{
+  int ma;
+  int min_val;
+  uint8_t inactive_cnt;
+  uint8_t raw;
+  uint8_t visited;
+  uint8_t next;     // blob search stack link
+} matrix_cell_t;
+
+typedef struct
+{
+  uint8_t cells;    // number of cells
+  uint8_t peak;     // max pressure
+  uint16_t sum;     // sum of pressure
+  uint8_t x16;      // pressure weighted centroid, column and row with 4 fractional bits
+  uint8_t y16;
+} matrix_blob_t;
+
+class VelostatMatrix
+{
+  public:
+    // rowPins: row drivers; muxPins: mux select lines (LSB first); analogPin: mux common output;
+    // cells and frame: buffers of size cells (rows are dropped if rows * cols does not fit)
+    VelostatMatrix(const uint8_t *rowPins, uint8_t rows, const uint8_t *muxPins, uint8_t muxBits,
+                   uint8_t analogPin, uint8_t cols, matrix_cell_t *cells, uint8_t *frame,
+                   unsigned int size);
+
+    void setSettleTime(unsigned int row_us, unsigned int col_us);
+    // tune column settle time so that a full scan lasts at most budget_us; return false if not possible
+    bool setFrameBudget(unsigned long budget_us);
+    // ghost compensation strength [0:255] (0 disabled, 255 full)
+    void setGhostCompensation(uint8_t strength);
+
+    // scan whole grid and update frame
+    void scan();
+    // duration (us) of last scan
+    unsigned long frameTime();
+
+    uint8_t rows();
+    uint8_t cols();
+    // pressure of a cell and whole frame (row major)
+    uint8_t get(uint8_t row, uint8_t col);
+    const uint8_t *frame();
+
+    // pressure weighted centroid of whole frame (4 fractional bits); false if nothing pressed
+    bool centroid(uint8_t *x16, uint8_t *y16);
+    // extract 4-connected blobs of cells above MATRIX_BLOB_THRESHOLD; return number found
+    uint8_t blobs(matrix_blob_t *blob, uint8_t max_blobs);
+
+  private:
+    const uint8_t *_rowPins;
+    const uint8_t *_muxPins;
+    uint8_t _rows;
+    uint8_t _cols;
+    uint8_t _muxBits;
+    uint8_t _analogPin;
+
+    unsigned int _row_settle;
+    unsigned int _col_settle;
+    uint8_t _ghost;
+    unsigned long _frame_time;
+
+    // per cell state and pressure frame (buffers of the sketch)
+    matrix_cell_t *_cells;
+    uint8_t *_frame;
+
+    void _selectColumn(uint8_t col, uint8_t prev);
+    void _trackCell(uint8_t cell, int raw);
+    void _compensateGhosts();
+};
+
+#endif // VelostatMatrix_h
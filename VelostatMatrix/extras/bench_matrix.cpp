@@ -0,0 +1,237 @@
+/*
+  bench_matrix.cpp - host benchmark of VelostatMatrix against a simulated grid
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Build and run on PC (not part of the Arduino library):
+    g++ -O2 -I../../extras/host -I.. bench_matrix.cpp \
+        ../VelostatMatrix.cpp ../../extras/host/Arduino.cpp -o bench_matrix
+    ./bench_matrix
+
+  The simulated grid answers analogRead() with the cell selected by the driven row
+  and mux lines, plus the ghost leaking through pressed cells in a rectangle.
+  Frame time is measured on the virtual clock, where I/O has the cost of a 16MHz AVR,
+  so frames per second are an estimate of the board ones.
+  (On 4x4 the press blobs overlap: the fourth corner is pressed too, not only a ghost.)
+  Then true presses (a soft blob, an L shape) are read on an 8x8 grid as they would
+  be with no ghost path, with ghosts and with default compensation. Checked: true
+  presses are not compensated below their no ghost value, the ghost of the L is
+  removed (under MATRIX_BLOB_THRESHOLD).
+*/
+
+#include <stdio.h>
+
+#include "Arduino.h"
+#include "VelostatMatrix.h"
+
+#define ROW_PIN_BASE 20
+#define MUX_PIN_BASE 10
+#define ANALOG_PIN   0
+#define MAX_SIZE     16
+
+#define IDLE_VALUE   200
+
+// frames for moving averages to settle on a new pressure map
+#define SETTLE_FRAMES 40
+
+static int grid_rows, grid_cols;
+static int pressure[MAX_SIZE][MAX_SIZE];
+static int driven_row = -1;
+static int mux_col = 0;
+static bool sim_ghosts = true;
+static int failures;
+
+// matrix buffers, sized for the largest grid
+static matrix_cell_t cells_buf[MAX_SIZE * MAX_SIZE];
+static uint8_t frame_buf[MAX_SIZE * MAX_SIZE];
+
+static void on_digital_write(uint8_t pin, int val)
+{
+  if ((pin >= ROW_PIN_BASE) && (pin < ROW_PIN_BASE + MAX_SIZE))
+  {
+    if (val == HIGH)
+      driven_row = pin - ROW_PIN_BASE;
+    else if (driven_row == pin - ROW_PIN_BASE)
+      driven_row = -1;
+  }
+  else if ((pin >= MUX_PIN_BASE) && (pin < MUX_PIN_BASE + 4))
+  {
+    int bit = 1 << (pin - MUX_PIN_BASE);
+    mux_col = (val == HIGH) ? (mux_col | bit) : (mux_col & ~bit);
+  }
+}
+
+static int on_analog_read(uint8_t)
+{
+  int r = driven_row;
+  int c = mux_col;
+  if ((r < 0) || (c >= grid_cols))
+    return IDLE_VALUE;
+
+  int v = IDLE_VALUE + pressure[r][c] + (rand() % 3) - 1;
+
+  // ghost: path r -> (r,c2) -> (r2,c2) -> (r2,c) through three pressed cells
+  int ghost = 0;
+  for (int r2 = 0; (sim_ghosts) && (r2 < grid_rows); r2++)
+  {
+    for (int c2 = 0; c2 < grid_cols; c2++)
+    {
+      if ((r2 != r) && (c2 != c))
+      {
+        int path = min(pressure[r][c2], min(pressure[r2][c2], pressure[r2][c]));
+        ghost = max(ghost, path / 2);
+      }
+    }
+  }
+  return min(v + ghost, 1023);
+}
+
+static void press(int r, int c, int val)
+{
+  // small blob: cell and its 4 neighbours at half pressure
+  pressure[r][c] = val;
+  if (r > 0) pressure[r - 1][c] = max(pressure[r - 1][c], val / 2);
+  if (r < grid_rows - 1) pressure[r + 1][c] = max(pressure[r + 1][c], val / 2);
+  if (c > 0) pressure[r][c - 1] = max(pressure[r][c - 1], val / 2);
+  if (c < grid_cols - 1) pressure[r][c + 1] = max(pressure[r][c + 1], val / 2);
+}
+
+static void run(int rows, int cols, unsigned long budget_us)
+{
+  static const uint8_t row_pins[MAX_SIZE] = { 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35 };
+  static const uint8_t mux_pins[4] = { 10, 11, 12, 13 };
+  int mux_bits = 0;
+  while ((1 << mux_bits) < cols)
+    mux_bits++;
+
+  grid_rows = rows;
+  grid_cols = cols;
+  memset(pressure, 0, sizeof(pressure));
+
+  VelostatMatrix m(row_pins, rows, mux_pins, mux_bits, ANALOG_PIN, cols, cells_buf, frame_buf,
+                   MAX_SIZE * MAX_SIZE);
+  bool in_budget = true;
+  if (budget_us > 0)
+    in_budget = m.setFrameBudget(budget_us);
+
+  // idle frames to settle baselines
+  for (int i = 0; i < 8; i++)
+    m.scan();
+
+  // three presses on rectangle corners: the fourth corner is a ghost
+  int r0 = rows / 4, r1 = rows - 1 - rows / 4;
+  int c0 = cols / 4, c1 = cols - 1 - cols / 4;
+  press(r0, c0, 300);
+  press(r0, c1, 300);
+  press(r1, c1, 300);
+
+  unsigned long start = micros();
+  const int frames = 20;
+  for (int i = 0; i < frames; i++)
+    m.scan();
+  unsigned long elapsed = micros() - start;
+
+  matrix_blob_t blob[8];
+  uint8_t found = m.blobs(blob, 8);
+  uint8_t ghost_on = m.get(r1, c0);
+  m.setGhostCompensation(0);
+  m.scan();
+  uint8_t ghost_off = m.get(r1, c0);
+
+  printf("%2dx%-2d  budget %6lu%s  frame %6lu us  %6.1f fps  blobs %d  ghost cell %3d (uncompensated %3d)\n",
+         rows, cols, budget_us, in_budget ? " " : "!", elapsed / frames,
+         1e6 * frames / elapsed, found, ghost_on, ghost_off);
+}
+
+// read cells of current pressure map: as they would be with no ghost path (truth),
+// with ghosts and no compensation, with default compensation
+static void read_cells(VelostatMatrix *m, const int (*cells)[2], int n, uint8_t *truth,
+                       uint8_t *off, uint8_t *on)
+{
+  m->setGhostCompensation(0);
+  sim_ghosts = false;
+  for (int i = 0; i < SETTLE_FRAMES; i++)
+    m->scan();
+  for (int i = 0; i < n; i++)
+    truth[i] = m->get(cells[i][0], cells[i][1]);
+
+  sim_ghosts = true;
+  for (int i = 0; i < SETTLE_FRAMES; i++)
+    m->scan();
+  for (int i = 0; i < n; i++)
+    off[i] = m->get(cells[i][0], cells[i][1]);
+
+  m->setGhostCompensation(128);
+  m->scan();
+  for (int i = 0; i < n; i++)
+    on[i] = m->get(cells[i][0], cells[i][1]);
+}
+
+// last cell is a ghost (ghost true) or a true press
+static void check_presses(const char *name, const int (*cells)[2], const char * const *labels, bool ghost)
+{
+  static const uint8_t row_pins[8] = { 20, 21, 22, 23, 24, 25, 26, 27 };
+  static const uint8_t mux_pins[3] = { 10, 11, 12 };
+  uint8_t truth[3], off[3], on[3];
+
+  VelostatMatrix m(row_pins, 8, mux_pins, 3, ANALOG_PIN, 8, cells_buf, frame_buf, 8 * 8);
+
+  // baselines settled with nothing pressed, then press
+  static int map[MAX_SIZE][MAX_SIZE];
+  memcpy(map, pressure, sizeof(map));
+  memset(pressure, 0, sizeof(pressure));
+  for (int i = 0; i < 8; i++)
+    m.scan();
+  memcpy(pressure, map, sizeof(map));
+
+  read_cells(&m, cells, 3, truth, off, on);
+  for (int i = 0; i < 3; i++)
+  {
+    bool ok = ((i == 2) && (ghost)) ? (on[i] < MATRIX_BLOB_THRESHOLD) : (on[i] >= truth[i]);
+    printf("%-6s %-16s %3d      %3d            %3d       %s\n", name, labels[i], truth[i], off[i], on[i],
+           ok ? "ok" : "FAIL");
+    if (!ok)
+      failures++;
+  }
+}
+
+static void check_true_presses()
+{
+  grid_rows = grid_cols = 8;
+  printf("8x8 press               no ghost  uncompensated  compensated  check\n");
+
+  // soft blob: its cells light each other as ghosts, compensation removes only that
+  static const int blob[][2] = { { 3, 3 }, { 3, 4 }, { 4, 4 } };
+  static const char * const blob_labels[] = { "center", "neighbour", "diagonal" };
+  memset(pressure, 0, sizeof(pressure));
+  for (int r = 0; r < 8; r++)
+    for (int c = 0; c < 8; c++)
+      pressure[r][c] = max(0, 200 - 60 * (abs(r - 3) + abs(c - 3)));
+  check_presses("blob", blob, blob_labels, false);
+
+  // L shape: corner and ends are true presses, the missing corner is a ghost
+  static const int l_shape[][2] = { { 2, 2 }, { 2, 5 }, { 5, 5 } };
+  static const char * const l_labels[] = { "corner", "end", "missing corner" };
+  memset(pressure, 0, sizeof(pressure));
+  pressure[2][2] = pressure[2][5] = pressure[5][2] = 200;
+  check_presses("L", l_shape, l_labels, true);
+}
+
+int main()
+{
+  host_on_digital_write(on_digital_write);
+  host_on_analog_read(on_analog_read);
+
+  static const int sizes[][2] = { { 4, 4 }, { 8, 4 }, { 8, 8 }, { 16, 8 }, { 16, 16 } };
+  printf("grid   budget (us)    frame time      frames/s\n");
+  for (unsigned i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+  {
+    run(sizes[i][0], sizes[i][1], 0);
+    run(sizes[i][0], sizes[i][1], 33333);   // 30 frames per second
+  }
+  printf("('!': budget too short for grid size, column settle time dropped to 0)\n");
+
+  check_true_presses();
+  return (failures == 0) ? 0 : 1;
+}
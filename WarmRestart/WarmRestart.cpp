@@ -0,0 +1,129 @@
+/*
+  WarmRestart.cpp - library to keep runtime state of sensors and leds across resets
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+*/
+
+#include "Arduino.h"
+#include "WarmRestart.h"
+
+#if defined(ARDUINO) && defined(__AVR__)
+#include <avr/eeprom.h>
+#define WARM_NOINIT_SECTION __attribute__((section(".noinit")))
+#else
+#define WARM_NOINIT_SECTION
+#endif // ARDUINO && __AVR__
+
+#define WARM_MAGIC 0x5752  // "WR"
+
+typedef struct
+{
+  uint16_t magic;
+  uint16_t size;
+  uint16_t checksum;
+} warm_header_t;
+
+#define WARM_BUFFER_SIZE (sizeof(warm_header_t) + WARM_RESTART_SIZE)
+
+// not cleared by startup code: content survives resets
+static uint8_t warm_noinit[WARM_BUFFER_SIZE] WARM_NOINIT_SECTION;
+
+#if !(defined(ARDUINO) && defined(__AVR__))
+// PC simulation: EEPROM emulated in RAM (kept across objects, as across a simulated reset)
+static uint8_t warm_eeprom[1024 + WARM_BUFFER_SIZE];
+#endif // !(ARDUINO && __AVR__)
+
+WarmRestart::WarmRestart(warm_storage_t storage, int eeprom_addr)
+{
+  _storage = storage;
+  _eeprom_addr = eeprom_addr;
+}
+
+// Fletcher-16 (sums kept below 255 with a subtraction, no division)
+uint16_t WarmRestart::_checksum(const uint8_t *data, uint16_t size)
+{
+  uint16_t sum1 = 0;
+  uint16_t sum2 = 0;
+
+  while (size--)
+  {
+    sum1 += *data++;
+    if (sum1 >= 255)
+      sum1 -= 255;
+    sum2 += sum1;
+    if (sum2 >= 255)
+      sum2 -= 255;
+  }
+  return (sum2 << 8) | sum1;
+}
+
+void WarmRestart::_write(uint16_t offset, const void *data, uint16_t size)
+{
+  if (_storage == WARM_NOINIT)
+  {
+    memcpy(warm_noinit + offset, data, size);
+    return;
+  }
+#if defined(ARDUINO) && defined(__AVR__)
+  // update: cells already holding the value are not written (endurance)
+  eeprom_update_block(data, (void *)(_eeprom_addr + offset), size);
+#else
+  memcpy(warm_eeprom + _eeprom_addr + offset, data, size);
+#endif // ARDUINO && __AVR__
+}
+
+void WarmRestart::_read(uint16_t offset, void *data, uint16_t size)
+{
+  if (_storage == WARM_NOINIT)
+  {
+    memcpy(data, warm_noinit + offset, size);
+    return;
+  }
+#if defined(ARDUINO) && defined(__AVR__)
+  eeprom_read_block(data, (const void *)(_eeprom_addr + offset), size);
+#else
+  memcpy(data, warm_eeprom + _eeprom_addr + offset, size);
+#endif // ARDUINO && __AVR__
+}
+
+void WarmRestart::save(const void *state, uint16_t size)
+{
+  if (size > WARM_RESTART_SIZE)
+    return;
+
+  warm_header_t header;
+  header.magic = WARM_MAGIC;
+  header.size = size;
+  header.checksum = _checksum((const uint8_t *)state, size);
+
+  // header first: a reset in the middle leaves a checksum mismatch, not a stale valid snapshot
+  _write(0, &header, sizeof(header));
+  _write(sizeof(header), state, size);
+}
+
+bool WarmRestart::restore(void *state, uint16_t size)
+{
+  warm_header_t header;
+  uint8_t data[WARM_RESTART_SIZE];
+
+  if (size > WARM_RESTART_SIZE)
+    return false;
+
+  _read(0, &header, sizeof(header));
+  if ((header.magic != WARM_MAGIC) || (header.size != size))
+    return false;
+
+  _read(sizeof(header), data, size);
+  if (_checksum(data, size) != header.checksum)
+    return false;
+
+  memcpy(state, data, size);
+  return true;
+}
+
+void WarmRestart::invalidate()
+{
+  uint16_t magic = 0;
+  _write(0, &magic, sizeof(magic));
+}
@@ -0,0 +1,71 @@
+/*
+  WarmRestart.h - library to keep runtime state of sensors and leds across resets
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  After a watchdog reset or a brown-out the sketch restores the last snapshot in
+  setup(), so sensors stay calibrated and patterns go on within the first loop:
+
+    struct { soft_press_state_t sensor; fading_pattern_state_t led; } state;
+    WarmRestart warm(WARM_NOINIT);
+
+    setup(): if (warm.restore(&state, sizeof(state)))
+             {
+               sensor.restoreState(&state.sensor);
+               led.restoreState(&state.led, timeNow());
+             }
+    loop():  sensor.saveState(&state.sensor);
+             led.saveState(&state.led, timeNow());
+             warm.save(&state, sizeof(state));
+
+  Snapshot has a header (magic, size) and a Fletcher-16 checksum: a power-on (random
+  RAM), a partial write or a change of state layout are detected and restore() fails.
+  Storage:
+    - WARM_NOINIT: RAM section not cleared at startup (.noinit on AVR), survives watchdog
+      and external resets, not power loss; save() can be called every loop (~100 bytes
+      copied and checksummed: tens of us)
+    - WARM_EEPROM: survives power loss too; only changed bytes are written, but EEPROM
+      endurance is ~100k writes per cell: save() every few seconds, not every loop
+  On boards other than AVR .noinit is not kept by the startup code: restore() just fails.
+*/
+
+#ifndef WARMRESTART_H_INCLUDED
+#define WARMRESTART_H_INCLUDED
+
+#include "Arduino.h"
+
+// max snapshot size (bytes, header excluded): fixed here, as buffers are allocated in
+// WarmRestart.cpp (a define in a sketch does not reach it)
+#define WARM_RESTART_SIZE 128
+
+typedef enum
+{
+  WARM_NOINIT,
+  WARM_EEPROM,
+} warm_storage_t;
+
+class WarmRestart
+{
+  public:
+    // eeprom_addr: snapshot offset in EEPROM (WARM_EEPROM only)
+    WarmRestart(warm_storage_t storage, int eeprom_addr = 0);
+
+    // store a snapshot of passed state (ignored if bigger than WARM_RESTART_SIZE)
+    void save(const void *state, uint16_t size);
+    // copy back last snapshot: false (state untouched) if none or not valid for this size
+    bool restore(void *state, uint16_t size);
+    // drop snapshot, e.g. on a clean shutdown: next start is a cold one
+    void invalidate();
+
+  private:
+    static uint16_t _checksum(const uint8_t *data, uint16_t size);
+
+    void _write(uint16_t offset, const void *data, uint16_t size);
+    void _read(uint16_t offset, void *data, uint16_t size);
+
+    warm_storage_t _storage;
+    int _eeprom_addr;
+};
+
+#endif // WARMRESTART_H_INCLUDED
@@ -0,0 +1,181 @@
+/*
+  sim_restart.cpp - host simulation of a reset with cold and warm restart
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Build and run on PC (not part of the Arduino library):
+    g++ -O2 -I../../extras/host -I.. -I../../TimeBase -I../../SoftPressSensor -I../../FadingPatternLed \
+        sim_restart.cpp ../WarmRestart.cpp ../../SoftPressSensor/SoftPressSensor.cpp \
+        ../../FadingPatternLed/FadingPatternLed.cpp ../../TimeBase/TimeBase.cpp \
+        ../../extras/host/Arduino.cpp -o sim_restart
+    ./sim_restart
+
+  A sketch with one SoftPressSensor exciting one FadingPatternLed runs on the virtual
+  clock; the pad is tapped once, then held from 6s to 16s. At RESET_AT_MS a reset is
+  simulated: objects are built again and millis() restarts from 0 after RESET_GAP_MS
+  (boot time), while the .noinit buffer survives as on the device. Compared with a run
+  with no reset:
+    - sensor reads returning NOT_CALIBRATED after the reset
+    - led output jump at the first loop after the reset
+    - mean led output error in the RECOVERY_MS after the reset
+  A warm restart resumes the pattern where it was at the reset, so it still lags the
+  run with no reset by the boot time (and the ramp steps missed meanwhile); a cold one
+  starts again from idle and the sensor waits for a new press to calibrate.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "Arduino.h"
+#include "SoftPressSensor.h"
+#include "FadingPatternLed.h"
+#include "WarmRestart.h"
+
+#define SENSOR_PIN 0
+#define LED_PIN    9
+
+#define LOOP_MS      10
+#define RUN_MS       20000UL
+#define RESET_AT_MS  12000UL
+#define RESET_GAP_MS 20
+#define RECOVERY_MS  4000UL
+
+#define IDLE_VALUE  300
+#define PRESS_VALUE 450
+
+// time of the installation (not reset as millis())
+static unsigned long wall_ms;
+static unsigned long boot_ms;
+
+static int on_analog_read(uint8_t)
+{
+  int noise = (rand() % 3) - 1;
+  unsigned long t = boot_ms + millis();
+  if (((t >= 2000) && (t < 2500)) || ((t >= 6000) && (t < 16000)))
+    return PRESS_VALUE + noise;
+  return IDLE_VALUE + noise;
+}
+
+static uint8_t led_pwm;
+static void on_analog_write(uint8_t, int value)
+{
+  led_pwm = value;
+}
+
+typedef struct
+{
+  soft_press_state_t sensor;
+  fading_pattern_state_t led;
+} sketch_state_t;
+
+static uint8_t reference[RUN_MS / LOOP_MS];
+
+typedef enum
+{
+  RUN_REFERENCE,
+  RUN_COLD,
+  RUN_WARM,
+} run_t;
+
+static void run(run_t mode)
+{
+  SoftPressSensor *sensor = NULL;
+  FadingPatternLed *led = NULL;
+  WarmRestart warm(WARM_NOINIT);
+  sketch_state_t state;
+
+  srand(1);
+  host_set_micros(0);
+  boot_ms = 0;
+  warm.invalidate();
+
+  int not_calibrated = 0;
+  int jump = 0;
+  unsigned long err_sum = 0;
+  uint8_t last_pwm = 0;
+  bool booting = true;
+
+  for (wall_ms = 0; wall_ms < RUN_MS; wall_ms += LOOP_MS)
+  {
+    if ((mode != RUN_REFERENCE) && (wall_ms == RESET_AT_MS))
+    {
+      // reset: RAM objects lost, millis() restarts after boot time
+      delete sensor;
+      delete led;
+      sensor = NULL;
+      booting = true;
+      boot_ms = wall_ms + RESET_GAP_MS;
+      host_set_micros(0);
+      continue;
+    }
+    if ((mode != RUN_REFERENCE) && (wall_ms > RESET_AT_MS) && (wall_ms < boot_ms))
+      continue;
+
+    if (booting)
+    {
+      // setup()
+      sensor = new SoftPressSensor(SENSOR_PIN);
+      led = new FadingPatternLed(LED_PIN, 1500, 500, 1500, 3000, 200);
+      if ((mode == RUN_WARM) && (warm.restore(&state, sizeof(state))))
+      {
+        sensor->restoreState(&state.sensor);
+        led->restoreState(&state.led, millis());
+      }
+      booting = false;
+    }
+
+    // loop()
+    host_set_micros((unsigned long long)(wall_ms - boot_ms) * 1000);
+    unsigned long now = millis();
+    int val = sensor->read();
+    led->exciting = sensor->isPressed();
+    if ((now % SAMPLING_TIME) == 0)
+      led->updatePattern();
+    led->UpdateDisplay(now);
+
+    if (mode == RUN_WARM)
+    {
+      sensor->saveState(&state.sensor);
+      led->saveState(&state.led, now);
+      warm.save(&state, sizeof(state));
+    }
+
+    int idx = wall_ms / LOOP_MS;
+    if (mode == RUN_REFERENCE)
+    {
+      reference[idx] = led_pwm;
+    }
+    else if ((boot_ms > 0) && (wall_ms >= boot_ms))
+    {
+      if (val == (int)NOT_CALIBRATED)
+        not_calibrated++;
+      if (wall_ms == boot_ms)
+        jump = abs((int)led_pwm - (int)last_pwm);
+      if (wall_ms < boot_ms + RECOVERY_MS)
+        err_sum += abs((int)led_pwm - (int)reference[idx]);
+    }
+    last_pwm = led_pwm;
+  }
+
+  delete sensor;
+  delete led;
+
+  if (mode != RUN_REFERENCE)
+  {
+    printf("%s restart: %4d reads NOT_CALIBRATED, led jump %3d, mean led error %5.1f over %lus\n",
+           (mode == RUN_COLD) ? "cold" : "warm", not_calibrated, jump,
+           (double)err_sum / (RECOVERY_MS / LOOP_MS), RECOVERY_MS / 1000);
+  }
+}
+
+int main()
+{
+  host_on_analog_read(on_analog_read);
+  host_on_analog_write(on_analog_write);
+
+  run(RUN_REFERENCE);
+  run(RUN_COLD);
+  run(RUN_WARM);
+  return 0;
+}
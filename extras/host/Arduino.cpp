@@ -0,0 +1,139 @@
+/*
+  Arduino.cpp - minimal Arduino core to build the libraries on PC
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+*/
+
+#include <stdio.h>
+#include "Arduino.h"
+
+// ~112us per conversion with default ADC prescaler, few us per pin write
+unsigned int host_analog_read_us = 112;
+unsigned int host_digital_write_us = 4;
+unsigned int host_analog_write_us = 6;
+
+HostSerial Serial;
+
+// 64-bit so that millis() and micros() can wrap independently as on the board
+static uint64_t host_us = 0;
+
+static host_read_hook_t  analog_read_hook = NULL;
+static host_read_hook_t  digital_read_hook = NULL;
+static host_write_hook_t digital_write_hook = NULL;
+static host_write_hook_t analog_write_hook = NULL;
+
+void host_set_micros(unsigned long us)
+{
+  host_us = us;
+}
+
+void host_advance_micros(unsigned long us)
+{
+  host_us += us;
+}
+
+void host_on_analog_read(host_read_hook_t hook)
+{
+  analog_read_hook = hook;
+}
+
+void host_on_digital_read(host_read_hook_t hook)
+{
+  digital_read_hook = hook;
+}
+
+void host_on_digital_write(host_write_hook_t hook)
+{
+  digital_write_hook = hook;
+}
+
+void host_on_analog_write(host_write_hook_t hook)
+{
+  analog_write_hook = hook;
+}
+
+void pinMode(uint8_t, uint8_t)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+  host_us += host_digital_write_us;
+  if (digital_write_hook != NULL)
+    digital_write_hook(pin, val);
+}
+
+int digitalRead(uint8_t pin)
+{
+  return (digital_read_hook != NULL) ? digital_read_hook(pin) : LOW;
+}
+
+int analogRead(uint8_t pin)
+{
+  host_us += host_analog_read_us;
+  return (analog_read_hook != NULL) ? analog_read_hook(pin) : 0;
+}
+
+void analogWrite(uint8_t pin, int val)
+{
+  host_us += host_analog_write_us;
+  if (analog_write_hook != NULL)
+    analog_write_hook(pin, constrain(val, 0, 255));
+}
+
+unsigned long millis()
+{
+  // 32-bit as on AVR: wraps after ~49.7 days
+  return (uint32_t)(host_us / 1000);
+}
+
+unsigned long micros()
+{
+  // 32-bit as on AVR: wraps after ~71 minutes
+  return (uint32_t)host_us;
+}
+
+void delay(unsigned long ms)
+{
+  host_us += ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  host_us += us;
+}
+
+long random(long howbig)
+{
+  return (howbig > 0) ? rand() % howbig : 0;
+}
+
+long random(long howsmall, long howbig)
+{
+  return (howbig > howsmall) ? howsmall + random(howbig - howsmall) : howsmall;
+}
+
+void HostSerial::print(const char *s)
+{
+  if (echo)
+    fputs(s, stdout);
+}
+
+void HostSerial::print(char c)
+{
+  if (echo)
+    fputc(c, stdout);
+}
+
+void HostSerial::print(long val, int base)
+{
+  if (echo)
+    printf((base == HEX) ? "%lX" : "%ld", val);
+}
+
+void HostSerial::print(double val, int digits)
+{
+  if (echo)
+    printf("%.*f", digits, val);
+}
@@ -0,0 +1,102 @@
+/*
+  Arduino.h - minimal Arduino core to build the libraries on PC
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  Not an Arduino library: used only by the host tools in each library extras/ folder
+  (simulations and benchmarks). Time is a virtual clock that moves only when
+  delay()/delayMicroseconds() are called, when a modeled I/O cost is spent
+  (analogRead, digitalWrite, analogWrite) or when the tool advances it, so every
+  run is deterministic. Pin I/O is routed to hooks set by the tool.
+*/
+
+#ifndef HOST_ARDUINO_H_INCLUDED
+#define HOST_ARDUINO_H_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <type_traits>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW  0
+#define INPUT        0
+#define OUTPUT       1
+#define INPUT_PULLUP 2
+
+#define DEC 10
+#define HEX 16
+
+#define PROGMEM
+#define pgm_read_byte(addr)  (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define memcpy_P(dst, src, n) memcpy((dst), (src), (n))
+#define F(str) (str)
+
+#define noInterrupts()
+#define interrupts()
+
+// as Arduino macros, but evaluated once
+template<class T, class U> inline typename std::common_type<T, U>::type min(T a, U b) { return (a < b) ? a : b; }
+template<class T, class U> inline typename std::common_type<T, U>::type max(T a, U b) { return (a > b) ? a : b; }
+template<class T, class L, class H> inline T constrain(T x, L lo, H hi) { return (x < lo) ? lo : ((x > hi) ? hi : x); }
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int  digitalRead(uint8_t pin);
+int  analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int val);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+
+// modeled cost (us) of I/O on a 16MHz AVR, spent on virtual clock at each call
+extern unsigned int host_analog_read_us;
+extern unsigned int host_digital_write_us;
+extern unsigned int host_analog_write_us;
+
+// virtual clock
+void host_set_micros(unsigned long us);
+void host_advance_micros(unsigned long us);
+
+// hooks: analogRead/digitalRead values come from tool, pin writes are reported to tool
+typedef int  (*host_read_hook_t)(uint8_t pin);
+typedef void (*host_write_hook_t)(uint8_t pin, int val);
+void host_on_analog_read(host_read_hook_t hook);
+void host_on_digital_read(host_read_hook_t hook);
+void host_on_digital_write(host_write_hook_t hook);
+void host_on_analog_write(host_write_hook_t hook);
+
+// Serial: output dropped unless echo is enabled
+class HostSerial
+{
+  public:
+    bool echo;
+    HostSerial() : echo(false) {}
+    void begin(long) {}
+    void print(const char *s);
+    void print(char c);
+    void print(long val, int base = DEC);
+    void print(int val, int base = DEC) { print((long)val, base); }
+    void print(unsigned int val, int base = DEC) { print((long)val, base); }
+    void print(unsigned long val, int base = DEC) { print((long)val, base); }
+    void print(double val, int digits = 2);
+    template<class T> void println(T val) { print(val); print('\n'); }
+    template<class T> void println(T val, int base) { print(val, base); print('\n'); }
+    void println() { print('\n'); }
+};
+extern HostSerial Serial;
+
+#endif // HOST_ARDUINO_H_INCLUDED
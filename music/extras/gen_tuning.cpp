@@ -0,0 +1,214 @@
+/*
+  gen_tuning.cpp - host generator of fixed point pitch and DDS phase increment tables
+  Created by LaBolla, October 19 2026
+  https://github.com/labolla
+  Released into the public domain.
+
+  pitches.h holds rounded integer frequencies for A4 = 440Hz equal temperament.
+  This tool computes, at build time, 16.16 fixed point frequencies and DDS phase
+  increments (see DdsSynth) for any reference pitch and temperament, so no math
+  is needed on device.
+
+  Build and run on PC (not part of the Arduino library):
+    g++ -O2 gen_tuning.cpp -o gen_tuning
+    ./gen_tuning > ../tuning.h                           (A4 = 440Hz, equal)
+    ./gen_tuning -a 432 -t just -k D -p just432 > just432.h
+    ./gen_tuning -t tet -n 19 -p tet19 > tet19.h
+
+  options:
+    -a <Hz>     reference pitch of A4 (default 440)
+    -t <type>   equal, just, pythagorean or tet (default equal)
+    -k <note>   tonic for just and pythagorean (default C)
+    -n <steps>  steps per octave for tet (default 12)
+    -r <Hz>     DDS sample rate for phase increments (default 15625, DDS_SAMPLE_RATE)
+    -p <name>   prefix of generated tables and macros (default tuning)
+
+  For 12 steps per octave the tables have the same layout of scale_chromatic[]
+  (scales.h: index 0 is B0, OCTAVE_n_IDX + X_OFFSET for others) and a macro is
+  generated for each NOTE_* name of pitches.h, with the prefix in upper case, e.g.
+  TUNING_NOTE_A4_Q16 and TUNING_NOTE_A4_INC (so several tables fit in one build).
+  For n-TET tables start from B0 and cover the same range up to DS8.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <string>
+
+// same layout of scale_chromatic[] in scales.h
+#define FULL_CHROMATIC_SIZE 89
+// index of A4 in scale_chromatic[] (OCTAVE_4_IDX + A_OFFSET)
+#define A4_IDX 46
+
+static const char *note_names[12] = { "C", "CS", "D", "DS", "E", "F", "FS", "G", "GS", "A", "AS", "B" };
+
+// 5-limit just intonation and pythagorean ratios from tonic
+static const double just_ratio[12] = {
+  1.0, 16.0/15, 9.0/8, 6.0/5, 5.0/4, 4.0/3, 45.0/32, 3.0/2, 8.0/5, 5.0/3, 9.0/5, 15.0/8 };
+static const double pyth_ratio[12] = {
+  1.0, 256.0/243, 9.0/8, 32.0/27, 81.0/64, 4.0/3, 729.0/512, 3.0/2, 128.0/81, 27.0/16, 16.0/9, 243.0/128 };
+
+static void usage(const char *name)
+{
+  fprintf(stderr, "usage: %s [-a Hz] [-t equal|just|pythagorean|tet] [-k note] [-n steps] [-r Hz] [-p prefix]\n", name);
+  exit(1);
+}
+
+// semitone (0..11 from C) of a note name, e.g. "C", "FS", "F#"
+static int semitone(const char *name)
+{
+  std::string n(name);
+  for (size_t i = 0; i < n.size(); i++)
+    n[i] = toupper(n[i]);
+  if ((n.size() == 2) && (n[1] == '#'))
+    n[1] = 'S';
+  for (int i = 0; i < 12; i++)
+  {
+    if (n == note_names[i])
+      return i;
+  }
+  fprintf(stderr, "unknown note %s\n", name);
+  exit(1);
+}
+
+// semitone (0..11 from C) and octave of scale_chromatic[] index
+static void index_note(int idx, int *semi, int *octave)
+{
+  *semi = (idx + 11) % 12;
+  *octave = (idx + 11) / 12;
+}
+
+int main(int argc, char *argv[])
+{
+  double a4 = 440.0;
+  std::string type = "equal";
+  int tonic = 0;
+  int steps = 12;
+  long rate = 15625;
+  std::string prefix = "tuning";
+
+  for (int i = 1; i < argc; i++)
+  {
+    if ((argv[i][0] != '-') || (i + 1 >= argc))
+      usage(argv[0]);
+    char opt = argv[i][1];
+    const char *val = argv[++i];
+    switch (opt)
+    {
+    case 'a': a4 = atof(val); break;
+    case 't': type = val; break;
+    case 'k': tonic = semitone(val); break;
+    case 'n': steps = atoi(val); break;
+    case 'r': rate = atol(val); break;
+    case 'p': prefix = val; break;
+    default: usage(argv[0]);
+    }
+  }
+  if ((a4 <= 0) || (rate <= 0) || (steps < 1) || (steps > 96))
+    usage(argv[0]);
+
+  // compute frequency table
+  double freq[1024];
+  int size;
+
+  if (type == "tet")
+  {
+    // n-TET from B0 (equal tempered for passed A4) up to DS8
+    double low = a4 * pow(2.0, (0 - A4_IDX) / 12.0);
+    double high = a4 * pow(2.0, (FULL_CHROMATIC_SIZE - 1 - A4_IDX) / 12.0);
+    size = (int)floor(log2(high / low) * steps + 1e-9) + 1;
+    for (int i = 0; i < size; i++)
+      freq[i] = low * pow(2.0, (double)i / steps);
+  }
+  else
+  {
+    const double *ratio = NULL;
+    if (type == "just")
+      ratio = just_ratio;
+    else if (type == "pythagorean")
+      ratio = pyth_ratio;
+    else if (type != "equal")
+      usage(argv[0]);
+
+    size = FULL_CHROMATIC_SIZE;
+    for (int idx = 0; idx < size; idx++)
+    {
+      int semi, octave;
+      index_note(idx, &semi, &octave);
+
+      if (ratio == NULL)
+      {
+        freq[idx] = a4 * pow(2.0, (idx - A4_IDX) / 12.0);
+      }
+      else
+      {
+        // tonic in octave 4 derived from A4 through its ratio, then every note from tonic
+        int a_from_tonic = (9 - tonic + 12) % 12;
+        double tonic4 = a4 / ratio[a_from_tonic];
+        if (tonic > 9)
+          tonic4 *= 2;   // tonic above A in octave 4
+        int from_tonic = (semi - tonic + 12) % 12;
+        int tonic_octave = octave - ((semi < tonic) ? 1 : 0);
+        freq[idx] = tonic4 * pow(2.0, tonic_octave - 4) * ratio[from_tonic];
+      }
+    }
+  }
+
+  std::string up = prefix;
+  for (size_t i = 0; i < up.size(); i++)
+    up[i] = toupper(up[i]);
+
+  printf("/*\n  generated by gen_tuning: do not edit\n");
+  printf("  A4 = %.3fHz, %s", a4, type.c_str());
+  if (type == "tet")
+    printf(" %d steps per octave", steps);
+  if ((type == "just") || (type == "pythagorean"))
+    printf(" on %s", note_names[tonic]);
+  printf(", phase increments for %ldHz sample rate\n*/\n\n", rate);
+
+  printf("#ifndef %s_H_INCLUDED\n#define %s_H_INCLUDED\n\n", up.c_str(), up.c_str());
+  printf("#include \"Arduino.h\"\n\n");
+  printf("#define %s_SIZE %d\n\n", up.c_str(), size);
+
+  // 16.16 frequencies
+  printf("const uint32_t %s_freq_q16[%s_SIZE] PROGMEM = {", prefix.c_str(), up.c_str());
+  for (int i = 0; i < size; i++)
+  {
+    if (i % 6 == 0)
+      printf("\n ");
+    printf(" 0x%08lXUL,", (unsigned long)lround(freq[i] * 65536.0));
+  }
+  printf("\n};\n\n");
+
+  // DDS phase increments for a 16-bit accumulator
+  printf("const uint16_t %s_phase_inc[%s_SIZE] PROGMEM = {", prefix.c_str(), up.c_str());
+  for (int i = 0; i < size; i++)
+  {
+    if (i % 12 == 0)
+      printf("\n ");
+    long inc = lround(freq[i] * 65536.0 / rate);
+    printf(" %5ld,", (inc > 0xFFFF) ? 0xFFFFL : inc);
+  }
+  printf("\n};\n");
+
+  // per note macros, names of pitches.h with table prefix
+  if (size == FULL_CHROMATIC_SIZE)
+  {
+    printf("\n");
+    for (int idx = 0; idx < size; idx++)
+    {
+      int semi, octave;
+      index_note(idx, &semi, &octave);
+      long inc = lround(freq[idx] * 65536.0 / rate);
+      char name[8];
+      snprintf(name, sizeof(name), "%s%d", note_names[semi], octave);
+      printf("#define %s_NOTE_%s_Q16 0x%08lXUL\n", up.c_str(), name, (unsigned long)lround(freq[idx] * 65536.0));
+      printf("#define %s_NOTE_%s_INC %ld\n", up.c_str(), name, (inc > 0xFFFF) ? 0xFFFFL : inc);
+    }
+  }
+
+  printf("\n#endif // %s_H_INCLUDED\n", up.c_str());
+  return 0;
+}
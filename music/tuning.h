@@ -0,0 +1,221 @@
+/*
+  generated by gen_tuning: do not edit
+  A4 = 440.000Hz, equal, phase increments for 15625Hz sample rate
+*/
+
+#ifndef TUNING_H_INCLUDED
+#define TUNING_H_INCLUDED
+
+#include "Arduino.h"
+
+#define TUNING_SIZE 89
+
+const uint32_t tuning_freq_q16[TUNING_SIZE] PROGMEM = {
+  0x001EDE22UL, 0x0020B405UL, 0x0022A5D8UL, 0x0024B546UL, 0x0026E410UL, 0x00293415UL,
+  0x002BA74EUL, 0x002E3FD2UL, 0x0030FFDBUL, 0x0033E9C0UL, 0x00370000UL, 0x003A453EUL,
+  0x003DBC44UL, 0x00416809UL, 0x00454BB0UL, 0x00496A8CUL, 0x004DC821UL, 0x0052682AUL,
+  0x00574E9BUL, 0x005C7FA5UL, 0x0061FFB5UL, 0x0067D380UL, 0x006E0000UL, 0x00748A7BUL,
+  0x007B7888UL, 0x0082D013UL, 0x008A9760UL, 0x0092D517UL, 0x009B9041UL, 0x00A4D054UL,
+  0x00AE9D37UL, 0x00B8FF49UL, 0x00C3FF6AUL, 0x00CFA700UL, 0x00DC0000UL, 0x00E914F6UL,
+  0x00F6F110UL, 0x0105A025UL, 0x01152EC1UL, 0x0125AA2EUL, 0x01372082UL, 0x0149A0A8UL,
+  0x015D3A6DUL, 0x0171FE92UL, 0x0187FED5UL, 0x019F4E01UL, 0x01B80000UL, 0x01D229ECUL,
+  0x01EDE220UL, 0x020B404AUL, 0x022A5D82UL, 0x024B545CUL, 0x026E4104UL, 0x0293414FUL,
+  0x02BA74DBUL, 0x02E3FD25UL, 0x030FFDAAUL, 0x033E9C01UL, 0x03700000UL, 0x03A453D9UL,
+  0x03DBC440UL, 0x04168094UL, 0x0454BB04UL, 0x0496A8B9UL, 0x04DC8208UL, 0x0526829EUL,
+  0x0574E9B6UL, 0x05C7FA4AUL, 0x061FFB54UL, 0x067D3803UL, 0x06E00000UL, 0x0748A7B1UL,
+  0x07B78880UL, 0x082D0128UL, 0x08A97607UL, 0x092D5172UL, 0x09B90410UL, 0x0A4D053DUL,
+  0x0AE9D36BUL, 0x0B8FF494UL, 0x0C3FF6A7UL, 0x0CFA7005UL, 0x0DC00000UL, 0x0E914F62UL,
+  0x0F6F1100UL, 0x105A0251UL, 0x1152EC0EUL, 0x125AA2E4UL, 0x13720820UL,
+};
+
+const uint16_t tuning_phase_inc[TUNING_SIZE] PROGMEM = {
+    129,   137,   145,   154,   163,   173,   183,   194,   206,   218,   231,   244,
+    259,   274,   291,   308,   326,   346,   366,   388,   411,   435,   461,   489,
+    518,   549,   581,   616,   652,   691,   732,   776,   822,   871,   923,   978,
+   1036,  1097,  1163,  1232,  1305,  1383,  1465,  1552,  1644,  1742,  1845,  1955,
+   2071,  2195,  2325,  2463,  2610,  2765,  2930,  3104,  3288,  3484,  3691,  3910,
+   4143,  4389,  4650,  4927,  5220,  5530,  5859,  6207,  6577,  6968,  7382,  7821,
+   8286,  8779,  9301,  9854, 10440, 11060, 11718, 12415, 13153, 13935, 14764, 15642,
+  16572, 17557, 18601, 19708, 20879,
+};
+
+#define TUNING_NOTE_B0_Q16 0x001EDE22UL
+#define TUNING_NOTE_B0_INC 129
+#define TUNING_NOTE_C1_Q16 0x0020B405UL
+#define TUNING_NOTE_C1_INC 137
+#define TUNING_NOTE_CS1_Q16 0x0022A5D8UL
+#define TUNING_NOTE_CS1_INC 145
+#define TUNING_NOTE_D1_Q16 0x0024B546UL
+#define TUNING_NOTE_D1_INC 154
+#define TUNING_NOTE_DS1_Q16 0x0026E410UL
+#define TUNING_NOTE_DS1_INC 163
+#define TUNING_NOTE_E1_Q16 0x00293415UL
+#define TUNING_NOTE_E1_INC 173
+#define TUNING_NOTE_F1_Q16 0x002BA74EUL
+#define TUNING_NOTE_F1_INC 183
+#define TUNING_NOTE_FS1_Q16 0x002E3FD2UL
+#define TUNING_NOTE_FS1_INC 194
+#define TUNING_NOTE_G1_Q16 0x0030FFDBUL
+#define TUNING_NOTE_G1_INC 206
+#define TUNING_NOTE_GS1_Q16 0x0033E9C0UL
+#define TUNING_NOTE_GS1_INC 218
+#define TUNING_NOTE_A1_Q16 0x00370000UL
+#define TUNING_NOTE_A1_INC 231
+#define TUNING_NOTE_AS1_Q16 0x003A453EUL
+#define TUNING_NOTE_AS1_INC 244
+#define TUNING_NOTE_B1_Q16 0x003DBC44UL
+#define TUNING_NOTE_B1_INC 259
+#define TUNING_NOTE_C2_Q16 0x00416809UL
+#define TUNING_NOTE_C2_INC 274
+#define TUNING_NOTE_CS2_Q16 0x00454BB0UL
+#define TUNING_NOTE_CS2_INC 291
+#define TUNING_NOTE_D2_Q16 0x00496A8CUL
+#define TUNING_NOTE_D2_INC 308
+#define TUNING_NOTE_DS2_Q16 0x004DC821UL
+#define TUNING_NOTE_DS2_INC 326
+#define TUNING_NOTE_E2_Q16 0x0052682AUL
+#define TUNING_NOTE_E2_INC 346
+#define TUNING_NOTE_F2_Q16 0x00574E9BUL
+#define TUNING_NOTE_F2_INC 366
+#define TUNING_NOTE_FS2_Q16 0x005C7FA5UL
+#define TUNING_NOTE_FS2_INC 388
+#define TUNING_NOTE_G2_Q16 0x0061FFB5UL
+#define TUNING_NOTE_G2_INC 411
+#define TUNING_NOTE_GS2_Q16 0x0067D380UL
+#define TUNING_NOTE_GS2_INC 435
+#define TUNING_NOTE_A2_Q16 0x006E0000UL
+#define TUNING_NOTE_A2_INC 461
+#define TUNING_NOTE_AS2_Q16 0x00748A7BUL
+#define TUNING_NOTE_AS2_INC 489
+#define TUNING_NOTE_B2_Q16 0x007B7888UL
+#define TUNING_NOTE_B2_INC 518
+#define TUNING_NOTE_C3_Q16 0x0082D013UL
+#define TUNING_NOTE_C3_INC 549
+#define TUNING_NOTE_CS3_Q16 0x008A9760UL
+#define TUNING_NOTE_CS3_INC 581
+#define TUNING_NOTE_D3_Q16 0x0092D517UL
+#define TUNING_NOTE_D3_INC 616
+#define TUNING_NOTE_DS3_Q16 0x009B9041UL
+#define TUNING_NOTE_DS3_INC 652
+#define TUNING_NOTE_E3_Q16 0x00A4D054UL
+#define TUNING_NOTE_E3_INC 691
+#define TUNING_NOTE_F3_Q16 0x00AE9D37UL
+#define TUNING_NOTE_F3_INC 732
+#define TUNING_NOTE_FS3_Q16 0x00B8FF49UL
+#define TUNING_NOTE_FS3_INC 776
+#define TUNING_NOTE_G3_Q16 0x00C3FF6AUL
+#define TUNING_NOTE_G3_INC 822
+#define TUNING_NOTE_GS3_Q16 0x00CFA700UL
+#define TUNING_NOTE_GS3_INC 871
+#define TUNING_NOTE_A3_Q16 0x00DC0000UL
+#define TUNING_NOTE_A3_INC 923
+#define TUNING_NOTE_AS3_Q16 0x00E914F6UL
+#define TUNING_NOTE_AS3_INC 978
+#define TUNING_NOTE_B3_Q16 0x00F6F110UL
+#define TUNING_NOTE_B3_INC 1036
+#define TUNING_NOTE_C4_Q16 0x0105A025UL
+#define TUNING_NOTE_C4_INC 1097
+#define TUNING_NOTE_CS4_Q16 0x01152EC1UL
+#define TUNING_NOTE_CS4_INC 1163
+#define TUNING_NOTE_D4_Q16 0x0125AA2EUL
+#define TUNING_NOTE_D4_INC 1232
+#define TUNING_NOTE_DS4_Q16 0x01372082UL
+#define TUNING_NOTE_DS4_INC 1305
+#define TUNING_NOTE_E4_Q16 0x0149A0A8UL
+#define TUNING_NOTE_E4_INC 1383
+#define TUNING_NOTE_F4_Q16 0x015D3A6DUL
+#define TUNING_NOTE_F4_INC 1465
+#define TUNING_NOTE_FS4_Q16 0x0171FE92UL
+#define TUNING_NOTE_FS4_INC 1552
+#define TUNING_NOTE_G4_Q16 0x0187FED5UL
+#define TUNING_NOTE_G4_INC 1644
+#define TUNING_NOTE_GS4_Q16 0x019F4E01UL
+#define TUNING_NOTE_GS4_INC 1742
+#define TUNING_NOTE_A4_Q16 0x01B80000UL
+#define TUNING_NOTE_A4_INC 1845
+#define TUNING_NOTE_AS4_Q16 0x01D229ECUL
+#define TUNING_NOTE_AS4_INC 1955
+#define TUNING_NOTE_B4_Q16 0x01EDE220UL
+#define TUNING_NOTE_B4_INC 2071
+#define TUNING_NOTE_C5_Q16 0x020B404AUL
+#define TUNING_NOTE_C5_INC 2195
+#define TUNING_NOTE_CS5_Q16 0x022A5D82UL
+#define TUNING_NOTE_CS5_INC 2325
+#define TUNING_NOTE_D5_Q16 0x024B545CUL
+#define TUNING_NOTE_D5_INC 2463
+#define TUNING_NOTE_DS5_Q16 0x026E4104UL
+#define TUNING_NOTE_DS5_INC 2610
+#define TUNING_NOTE_E5_Q16 0x0293414FUL
+#define TUNING_NOTE_E5_INC 2765
+#define TUNING_NOTE_F5_Q16 0x02BA74DBUL
+#define TUNING_NOTE_F5_INC 2930
+#define TUNING_NOTE_FS5_Q16 0x02E3FD25UL
+#define TUNING_NOTE_FS5_INC 3104
+#define TUNING_NOTE_G5_Q16 0x030FFDAAUL
+#define TUNING_NOTE_G5_INC 3288
+#define TUNING_NOTE_GS5_Q16 0x033E9C01UL
+#define TUNING_NOTE_GS5_INC 3484
+#define TUNING_NOTE_A5_Q16 0x03700000UL
+#define TUNING_NOTE_A5_INC 3691
+#define TUNING_NOTE_AS5_Q16 0x03A453D9UL
+#define TUNING_NOTE_AS5_INC 3910
+#define TUNING_NOTE_B5_Q16 0x03DBC440UL
+#define TUNING_NOTE_B5_INC 4143
+#define TUNING_NOTE_C6_Q16 0x04168094UL
+#define TUNING_NOTE_C6_INC 4389
+#define TUNING_NOTE_CS6_Q16 0x0454BB04UL
+#define TUNING_NOTE_CS6_INC 4650
+#define TUNING_NOTE_D6_Q16 0x0496A8B9UL
+#define TUNING_NOTE_D6_INC 4927
+#define TUNING_NOTE_DS6_Q16 0x04DC8208UL
+#define TUNING_NOTE_DS6_INC 5220
+#define TUNING_NOTE_E6_Q16 0x0526829EUL
+#define TUNING_NOTE_E6_INC 5530
+#define TUNING_NOTE_F6_Q16 0x0574E9B6UL
+#define TUNING_NOTE_F6_INC 5859
+#define TUNING_NOTE_FS6_Q16 0x05C7FA4AUL
+#define TUNING_NOTE_FS6_INC 6207
+#define TUNING_NOTE_G6_Q16 0x061FFB54UL
+#define TUNING_NOTE_G6_INC 6577
+#define TUNING_NOTE_GS6_Q16 0x067D3803UL
+#define TUNING_NOTE_GS6_INC 6968
+#define TUNING_NOTE_A6_Q16 0x06E00000UL
+#define TUNING_NOTE_A6_INC 7382
+#define TUNING_NOTE_AS6_Q16 0x0748A7B1UL
+#define TUNING_NOTE_AS6_INC 7821
+#define TUNING_NOTE_B6_Q16 0x07B78880UL
+#define TUNING_NOTE_B6_INC 8286
+#define TUNING_NOTE_C7_Q16 0x082D0128UL
+#define TUNING_NOTE_C7_INC 8779
+#define TUNING_NOTE_CS7_Q16 0x08A97607UL
+#define TUNING_NOTE_CS7_INC 9301
+#define TUNING_NOTE_D7_Q16 0x092D5172UL
+#define TUNING_NOTE_D7_INC 9854
+#define TUNING_NOTE_DS7_Q16 0x09B90410UL
+#define TUNING_NOTE_DS7_INC 10440
+#define TUNING_NOTE_E7_Q16 0x0A4D053DUL
+#define TUNING_NOTE_E7_INC 11060
+#define TUNING_NOTE_F7_Q16 0x0AE9D36BUL
+#define TUNING_NOTE_F7_INC 11718
+#define TUNING_NOTE_FS7_Q16 0x0B8FF494UL
+#define TUNING_NOTE_FS7_INC 12415
+#define TUNING_NOTE_G7_Q16 0x0C3FF6A7UL
+#define TUNING_NOTE_G7_INC 13153
+#define TUNING_NOTE_GS7_Q16 0x0CFA7005UL
+#define TUNING_NOTE_GS7_INC 13935
+#define TUNING_NOTE_A7_Q16 0x0DC00000UL
+#define TUNING_NOTE_A7_INC 14764
+#define TUNING_NOTE_AS7_Q16 0x0E914F62UL
+#define TUNING_NOTE_AS7_INC 15642
+#define TUNING_NOTE_B7_Q16 0x0F6F1100UL
+#define TUNING_NOTE_B7_INC 16572
+#define TUNING_NOTE_C8_Q16 0x105A0251UL
+#define TUNING_NOTE_C8_INC 17557
+#define TUNING_NOTE_CS8_Q16 0x1152EC0EUL
+#define TUNING_NOTE_CS8_INC 18601
+#define TUNING_NOTE_D8_Q16 0x125AA2E4UL
+#define TUNING_NOTE_D8_INC 19708
+#define TUNING_NOTE_DS8_Q16 0x13720820UL
+#define TUNING_NOTE_DS8_INC 20879
+
+#endif // TUNING_H_INCLUDED